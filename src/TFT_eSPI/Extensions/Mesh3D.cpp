@@ -0,0 +1,421 @@
+/***************************************************************************************
+** Code for the 3D mesh renderer
+** Screen positions have 4 fraction bits and the rows are filled with the same centre
+** sampling rule as fillPolygon(), so faces sharing an edge neither overlap nor leave gaps
+***************************************************************************************/
+TFT_eSPI_Mesh3D::TFT_eSPI_Mesh3D(void) {
+  _spr       = nullptr;
+  _img       = nullptr;
+  _depth     = nullptr;
+  _w = _h    = 0;
+  _vtx       = nullptr;
+  _order     = nullptr;
+  _vtxSize   = 0;
+  _orderSize = 0;
+  _cx = _cy  = 0;
+  _focal     = 100;
+  _distance  = 100;
+  _shading   = MESH_FLAT;
+  setRotation(0, 0, 0);
+  setLight(-1, 1, -2);
+}
+
+TFT_eSPI_Mesh3D::~TFT_eSPI_Mesh3D(void) {
+  end();
+}
+
+bool TFT_eSPI_Mesh3D::begin(TFT_eSprite *spr, bool depth)
+{
+  end();
+
+  if (!spr || !spr->created() || (spr->getColorDepth() != 16)) return false;
+
+  // Faces are drawn in Sprite memory, width() and height() are less with a datum viewport
+  _spr = spr;
+  _w   = spr->_iwidth;
+  _h   = spr->_iheight;
+  _cx  = _w / 2;
+  _cy  = _h / 2;
+
+  if (depth) {
+    // Depth is tested for every pixel so internal RAM is tried first
+    _depth = (uint16_t*) malloc(_w * _h * sizeof(uint16_t));
+#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
+    if (!_depth && psramFound()) _depth = (uint16_t*) ps_malloc(_w * _h * sizeof(uint16_t));
+#endif
+    if (_depth) memset(_depth, 0, _w * _h * sizeof(uint16_t));
+  }
+
+  return true;
+}
+
+void TFT_eSPI_Mesh3D::end(void)
+{
+  if (_depth) free(_depth);
+  if (_vtx)   free(_vtx);
+  if (_order) free(_order);
+  _depth     = nullptr;
+  _vtx       = nullptr;
+  _order     = nullptr;
+  _vtxSize   = 0;
+  _orderSize = 0;
+  _spr       = nullptr;
+}
+
+bool TFT_eSPI_Mesh3D::hasDepthBuffer(void)
+{
+  return _depth != nullptr;
+}
+
+void TFT_eSPI_Mesh3D::setProjection(int16_t cx, int16_t cy, uint16_t focal, uint16_t distance)
+{
+  _cx       = cx;
+  _cy       = cy;
+  _focal    = focal;
+  _distance = distance ? distance : 1;
+}
+
+// The matrix is Rz * Ry * Rx, found once per frame so vertices need no trigonometry
+void TFT_eSPI_Mesh3D::setRotation(float ax, float ay, float az)
+{
+  float sx = sin(ax * 0.0174532925), cx = cos(ax * 0.0174532925);
+  float sy = sin(ay * 0.0174532925), cy = cos(ay * 0.0174532925);
+  float sz = sin(az * 0.0174532925), cz = cos(az * 0.0174532925);
+
+  float m[9] = {
+    cz * cy, cz * sy * sx - sz * cx, cz * sy * cx + sz * sx,
+    sz * cy, sz * sy * sx + cz * cx, sz * sy * cx - cz * sx,
+    -sy,     cy * sx,                cy * cx
+  };
+
+  for (uint8_t i = 0; i < 9; i++) _m[i] = (int16_t)(m[i] * 16384 + (m[i] < 0 ? -0.5 : 0.5));
+}
+
+void TFT_eSPI_Mesh3D::setLight(float x, float y, float z, uint8_t ambient)
+{
+  float len = sqrt(x * x + y * y + z * z);
+  if (len <= 0) { x = 0; y = 0; z = -1; len = 1; }
+
+  _light[0] = x * 16384 / len;
+  _light[1] = y * 16384 / len;
+  _light[2] = z * 16384 / len;
+  _ambient  = ambient;
+}
+
+void TFT_eSPI_Mesh3D::setShading(uint8_t mode)
+{
+  _shading = mode;
+}
+
+void TFT_eSPI_Mesh3D::clear(uint16_t color)
+{
+  if (!_spr) return;
+
+  _spr->fillSprite(color);
+  if (_depth) memset(_depth, 0, _w * _h * sizeof(uint16_t));
+}
+
+// Sort order for faces without a depth buffer
+static int meshFarFirst(const void *a, const void *b)
+{
+  int32_t za = *(const int32_t*)a, zb = *(const int32_t*)b;
+  return (za < zb) - (za > zb);
+}
+
+static uint32_t meshSqrt(uint32_t v)
+{
+  uint32_t r = 0, b = 1UL << 30;
+  while (b > v) b >>= 2;
+  while (b) {
+    if (v >= r + b) { v -= r + b; r = (r >> 1) + b; }
+    else r >>= 1;
+    b >>= 2;
+  }
+  return r;
+}
+
+uint16_t TFT_eSPI_Mesh3D::draw(const int16_t *vertices, uint16_t nv, const uint16_t *faces, uint16_t nf,
+                               const uint16_t *colors, uint16_t color, const int8_t *normals)
+{
+  if (!_spr || !_spr->created() || !vertices || !faces || !reserve(nv, nf)) return 0;
+
+  // The Sprite may have been recreated or its frame changed since begin()
+  _img = (uint16_t*)_spr->getFramePointer();
+  if (!_img || (_spr->_iwidth != _w) || (_spr->_iheight != _h)) return 0;
+
+  bool gouraud = (_shading == MESH_GOURAUD) && normals;
+
+  // Nearest depth that is drawn, 1/16 model units
+  int32_t zNear = (int32_t)_distance << 3;
+
+  // Transform, the view position keeps 4 fraction bits
+  for (uint16_t i = 0; i < nv; i++) {
+    const int16_t *v = vertices + 3 * i;
+    meshVertex    *p = _vtx + i;
+
+    p->vx = (_m[0] * v[0] + _m[1] * v[1] + _m[2] * v[2]) >> 10;
+    p->vy = (_m[3] * v[0] + _m[4] * v[1] + _m[5] * v[2]) >> 10;
+    p->vz = (_m[6] * v[0] + _m[7] * v[1] + _m[8] * v[2]) >> 10;
+
+    int32_t z = p->vz + ((int32_t)_distance << 4);
+    if (z < zNear) { p->q = 0; continue; }
+
+    // Project to 1/16 pixel, far off positions are limited so later products fit
+    int64_t k  = ((int64_t)_focal << 20) / z;
+    int64_t sx = (p->vx * k) >> 16;
+    int64_t sy = (p->vy * k) >> 16;
+    if (sx > (1 << 20)) sx = 1 << 20; else if (sx < -(1 << 20)) sx = -(1 << 20);
+    if (sy > (1 << 20)) sy = 1 << 20; else if (sy < -(1 << 20)) sy = -(1 << 20);
+    p->sx = ((int32_t)_cx * 16) + sx;
+    p->sy = ((int32_t)_cy * 16) - sy;
+
+    // Depth is proportional to 1/z so it can be interpolated linearly across the screen.
+    // 0xFF00 at the near limit leaves room for rounding, 0 is never drawn
+    p->q = ((int64_t)zNear * 0xFF00) / z;
+    if (!p->q) p->q = 1;
+
+    if (gouraud) {
+      const int8_t *n = normals + 3 * i;
+      p->i = light((_m[0] * n[0] + _m[1] * n[1] + _m[2] * n[2]) >> 14,
+                   (_m[3] * n[0] + _m[4] * n[1] + _m[5] * n[2]) >> 14,
+                   (_m[6] * n[0] + _m[7] * n[1] + _m[8] * n[2]) >> 14, 127);
+    }
+  }
+
+  // Collect the front faces, anticlockwise seen from the eye is clockwise on the screen
+  uint16_t count = 0;
+  for (uint16_t f = 0; f < nf; f++) {
+    const uint16_t *t = faces + 3 * f;
+    if ((t[0] >= nv) || (t[1] >= nv) || (t[2] >= nv)) continue;
+
+    meshVertex *a = _vtx + t[0], *b = _vtx + t[1], *c = _vtx + t[2];
+    if (!a->q || !b->q || !c->q) continue;
+
+    int64_t area = (int64_t)(b->sx - a->sx) * (c->sy - a->sy) - (int64_t)(b->sy - a->sy) * (c->sx - a->sx);
+    if (area >= 0) continue;
+
+    _order[count].z = a->vz + b->vz + c->vz;
+    _order[count].f = f;
+    count++;
+  }
+
+  // Without a depth buffer the far faces are drawn first so near faces cover them
+  if (!_depth) qsort(_order, count, sizeof(meshOrder), meshFarFirst);
+
+  _x0 = _w; _y0 = _h; _x1 = -1; _y1 = -1;
+
+  for (uint16_t k = 0; k < count; k++) {
+    uint16_t f = _order[k].f;
+    const uint16_t *t = faces + 3 * f;
+    meshVertex *a = _vtx + t[0], *b = _vtx + t[1], *c = _vtx + t[2];
+    uint16_t fc = colors ? colors[f] : color;
+
+    if ((_shading == MESH_FLAT) || ((_shading == MESH_GOURAUD) && !gouraud)) {
+      // Face normal in view space, reduced to 15 bits so the length fits 32 bits
+      int64_t ux = c->vx - a->vx, uy = c->vy - a->vy, uz = c->vz - a->vz;
+      int64_t wx = b->vx - a->vx, wy = b->vy - a->vy, wz = b->vz - a->vz;
+      int64_t nx = uy * wz - uz * wy, ny = uz * wx - ux * wz, nz = ux * wy - uy * wx;
+      int64_t big = (nx < 0 ? -nx : nx) | (ny < 0 ? -ny : ny) | (nz < 0 ? -nz : nz);
+      uint8_t shift = 0;
+      while ((big >> shift) > 32767) shift++;
+      nx >>= shift; ny >>= shift; nz >>= shift;
+      uint32_t len = meshSqrt((uint32_t)(nx * nx + ny * ny + nz * nz));
+      fc = fastBlend(light(nx, ny, nz, len), fc, 0);
+    }
+
+    drawFace(a, b, c, fc, gouraud);
+  }
+
+  if (_x1 >= _x0) _spr->markDirty(_x0 - _spr->getViewportX(), _y0 - _spr->getViewportY(), _x1 - _x0 + 1, _y1 - _y0 + 1);
+
+  return count;
+}
+
+// Work space grows to the largest mesh drawn
+bool TFT_eSPI_Mesh3D::reserve(uint16_t nv, uint16_t nf)
+{
+  if (nv > _vtxSize) {
+    meshVertex *v = (meshVertex*) realloc(_vtx, nv * sizeof(meshVertex));
+    if (!v) return false;
+    _vtx = v;
+    _vtxSize = nv;
+  }
+
+  if (nf > _orderSize) {
+    meshOrder *o = (meshOrder*) realloc(_order, nf * sizeof(meshOrder));
+    if (!o) return false;
+    _order = o;
+    _orderSize = nf;
+  }
+
+  return true;
+}
+
+// Light level for a normal of length len, the light direction is a unit vector of 16384
+uint8_t TFT_eSPI_Mesh3D::light(int32_t nx, int32_t ny, int32_t nz, int32_t len)
+{
+  int32_t d = nx * _light[0] + ny * _light[1] + nz * _light[2];
+  if ((d <= 0) || (len <= 0)) return _ambient;
+
+  int32_t diffuse = (d >> 6) / len; // 0 to 256
+  if (diffuse > 256) diffuse = 256;
+
+  return _ambient + (((255 - _ambient) * diffuse) >> 8);
+}
+
+// Set up edge a to b (a above b) at row y. The first pixel with a centre on or right of the
+// edge is ceil(N / 16dy), N = 16dy * ax + (16y + 8 - ay) * 16dx - 128dy in 1/16 pixels (as
+// for fillPolygon() with dy and dx in 1/16 pixels). N is kept as a quotient and remainder
+// so there is no rounding error
+void TFT_eSPI_Mesh3D::setEdge(meshEdge *e, const meshVertex *a, const meshVertex *b, int32_t y)
+{
+  int32_t dy = b->sy - a->sy, dx = b->sx - a->sx;
+  if (dy <= 0) { e->x = 0; e->r = 0; e->dx = 0; e->dr = 0; e->d = 1; return; }
+
+  int64_t num = (int64_t)a->sx * dy + (int64_t)((y << 4) + 8 - a->sy) * dx - 8 * (int64_t)dy;
+
+  e->d  = dy << 4;
+  if (num == (int32_t)num) { // 32 bit division is much faster on most processors
+    e->x = (int32_t)num / e->d;
+    e->r = (int32_t)num % e->d;
+  }
+  else {
+    e->x = num / e->d;
+    e->r = num % e->d;
+  }
+  if (e->r < 0) { e->r += e->d; e->x--; }
+
+  e->dx = (dx * 16) / e->d;
+  e->dr = (dx * 16) % e->d;
+  if (e->dr < 0) { e->dr += e->d; e->dx--; }
+}
+
+void TFT_eSPI_Mesh3D::stepEdge(meshEdge *e)
+{
+  e->x += e->dx;
+  e->r += e->dr;
+  if (e->r >= e->d) { e->r -= e->d; e->x++; }
+}
+
+// Depth and light level are planes across the face with 12 fraction bits, each span
+// starts from the exact value at its first pixel centre
+void TFT_eSPI_Mesh3D::drawFace(const meshVertex *a, const meshVertex *b, const meshVertex *c, uint16_t color, bool gouraud)
+{
+  if (b->sy < a->sy) transpose(a, b);
+  if (c->sy < a->sy) transpose(a, c);
+  if (c->sy < b->sy) transpose(b, c);
+
+  // Rows with a centre from a to c
+  int32_t y = (a->sy + 7) >> 4, yMid = (b->sy + 7) >> 4, yEnd = (c->sy + 7) >> 4;
+  if (y < 0) y = 0;
+  if (yEnd > _h) yEnd = _h;
+  if (y >= yEnd) return;
+
+  int64_t ex1 = b->sx - a->sx, ey1 = b->sy - a->sy;
+  int64_t ex2 = c->sx - a->sx, ey2 = c->sy - a->sy;
+  int64_t det = ex1 * ey2 - ex2 * ey1;
+  if (!det) return;
+
+  int64_t dq1 = b->q - a->q, dq2 = c->q - a->q;
+  int32_t qdx = ((dq1 * ey2 - dq2 * ey1) * 65536) / det; // Per pixel, 12 fraction bits
+  int32_t qdy = ((dq2 * ex1 - dq1 * ex2) * 65536) / det;
+
+  int32_t idx = 0, idy = 0;
+  if (gouraud) {
+    int64_t di1 = b->i - a->i, di2 = c->i - a->i;
+    idx = ((di1 * ey2 - di2 * ey1) * 65536) / det;
+    idy = ((di2 * ex1 - di1 * ex2) * 65536) / det;
+  }
+
+  uint16_t swapped = (color >> 8) | (color << 8);
+
+  meshEdge el, es;
+  setEdge(&el, a, c, y);
+  if (y < yMid) setEdge(&es, a, b, y);
+  else setEdge(&es, b, c, y);
+
+  for (; y < yEnd; y++) {
+    if (y == yMid) setEdge(&es, b, c, y);
+
+    int32_t xa = el.x + (el.r > 0), xb = es.x + (es.r > 0);
+    if (xa > xb) transpose(xa, xb);
+    if (xa < 0)  xa = 0;
+    if (xb > _w) xb = _w;
+
+    if (xa < xb) {
+      if (xa < _x0) _x0 = xa;
+      if (xb > _x1 + 1) _x1 = xb - 1;
+      if (y < _y0) _y0 = y;
+      if (y > _y1) _y1 = y;
+
+      int32_t   n = xb - xa;
+      uint16_t *p = _img + y * _w + xa;
+      uint16_t *z = _depth ? _depth + y * _w + xa : nullptr;
+      int64_t   rx = (xa << 4) + 8 - a->sx, ry = (y << 4) + 8 - a->sy;
+      int32_t   q = ((int32_t)a->q << 12) + ((qdx * rx + qdy * ry) >> 4);
+
+      if (!gouraud) {
+        if (z) {
+          while (n--) {
+            if ((q >> 12) > *z) { *z = q >> 12; *p = swapped; }
+            q += qdx; p++; z++;
+          }
+        }
+        else while (n--) *p++ = swapped;
+      }
+      else {
+        int32_t i = ((int32_t)a->i << 12) + ((idx * rx + idy * ry) >> 4);
+        while (n--) {
+          if (!z || (q >> 12) > *z) {
+            if (z) *z = q >> 12;
+            int32_t s = i >> 12;
+            uint16_t col = fastBlend(s < 0 ? 0 : (s > 255 ? 255 : s), color, 0);
+            *p = (col >> 8) | (col << 8);
+          }
+          q += qdx; i += idx; p++;
+          if (z) z++;
+        }
+      }
+    }
+
+    stepEdge(&el);
+    stepEdge(&es);
+  }
+}
+
+void TFT_eSPI_Mesh3D::computeNormals(const int16_t *vertices, uint16_t nv, const uint16_t *faces,
+                                     uint16_t nf, int8_t *normals)
+{
+  if (!vertices || !faces || !normals) return;
+
+  memset(normals, 0, 3 * nv);
+
+  float *sum = (float*) calloc(3 * nv, sizeof(float));
+  if (!sum) return;
+
+  // Face normals are not made unit length so large faces count for more
+  for (uint16_t f = 0; f < nf; f++) {
+    const uint16_t *t = faces + 3 * f;
+    if ((t[0] >= nv) || (t[1] >= nv) || (t[2] >= nv)) continue;
+
+    const int16_t *a = vertices + 3 * t[0], *b = vertices + 3 * t[1], *c = vertices + 3 * t[2];
+    float ux = c[0] - a[0], uy = c[1] - a[1], uz = c[2] - a[2];
+    float wx = b[0] - a[0], wy = b[1] - a[1], wz = b[2] - a[2];
+    float nx = uy * wz - uz * wy, ny = uz * wx - ux * wz, nz = ux * wy - uy * wx;
+
+    for (uint8_t k = 0; k < 3; k++) {
+      sum[3 * t[k]]     += nx;
+      sum[3 * t[k] + 1] += ny;
+      sum[3 * t[k] + 2] += nz;
+    }
+  }
+
+  for (uint16_t i = 0; i < nv; i++) {
+    float *s = sum + 3 * i;
+    float len = sqrt(s[0] * s[0] + s[1] * s[1] + s[2] * s[2]);
+    if (len <= 0) continue;
+    for (uint8_t k = 0; k < 3; k++) normals[3 * i + k] = (int8_t)(s[k] * 127 / len);
+  }
+
+  free(sum);
+}
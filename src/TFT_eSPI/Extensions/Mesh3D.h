@@ -0,0 +1,85 @@
+/***************************************************************************************
+// 3D mesh renderer for 16 bit Sprites. Vertices are rotated and projected with fixed
+// point arithmetic, back faces are culled and triangles are filled a row at a time
+// with solid, flat or Gouraud shading. Hidden faces are removed with a 16 bit depth
+// buffer, or if there is no memory for one by drawing the faces far to near.
+***************************************************************************************/
+
+// Shading modes for setShading()
+#define MESH_SOLID   0 // Face colours as given
+#define MESH_FLAT    1 // One light level per face
+#define MESH_GOURAUD 2 // Light level per vertex, blended across each face (needs vertex normals)
+
+class TFT_eSPI_Mesh3D
+{
+ public:
+  TFT_eSPI_Mesh3D(void);
+  ~TFT_eSPI_Mesh3D(void);
+
+  // Render into a created 16bpp Sprite, which must not be rotated with setRotation(). With
+  // depth true a depth buffer of 2 bytes per pixel is allocated, if there is not enough
+  // memory faces are sorted instead. Returns false if the Sprite cannot be used
+  bool     begin(TFT_eSprite *spr, bool depth = true);
+  // Free the depth buffer and work space
+  void     end(void);
+  // Returns true if a depth buffer is in use
+  bool     hasDepthBuffer(void);
+
+  // The model origin is shown at cx,cy in the Sprite, distance model units from the eye.
+  // focal is the focal length in pixels. Faces closer to the eye than distance / 2 are not drawn
+  void     setProjection(int16_t cx, int16_t cy, uint16_t focal, uint16_t distance);
+  // Rotate the model about the x axis, then the y axis, then the z axis, angles in degrees
+  void     setRotation(float ax, float ay, float az);
+  // Direction towards the light in view coordinates (need not be unit length) and the
+  // light level 0-255 of faces turned away from it
+  void     setLight(float x, float y, float z, uint8_t ambient = 48);
+  // MESH_SOLID, MESH_FLAT or MESH_GOURAUD
+  void     setShading(uint8_t mode);
+
+  // Fill the Sprite with color and clear the depth buffer, call at the start of each frame
+  void     clear(uint16_t color);
+
+  // Draw nf triangles. vertices[] holds x,y,z for nv vertices (x right, y up, z away from the
+  // eye) and faces[] holds 3 vertex numbers per triangle, anticlockwise when seen from the
+  // front. colors[] holds a colour per face, or is nullptr to use color for all faces.
+  // normals[] holds x,y,z per vertex scaled to 127, needed for MESH_GOURAUD and made by
+  // computeNormals(). Returns the number of triangles drawn
+  uint16_t draw(const int16_t *vertices, uint16_t nv, const uint16_t *faces, uint16_t nf,
+                const uint16_t *colors, uint16_t color = TFT_WHITE, const int8_t *normals = nullptr);
+
+  // Make vertex normals for Gouraud shading by averaging the faces that use each vertex,
+  // normals[] must have room for 3 * nv values
+  static void computeNormals(const int16_t *vertices, uint16_t nv, const uint16_t *faces,
+                             uint16_t nf, int8_t *normals);
+
+ private:
+  // Projected vertex: view position (1/16 model units), screen position (1/16 pixels),
+  // depth (larger is nearer, 0 if too near the eye to draw) and light level
+  typedef struct { int32_t vx, vy, vz, sx, sy; uint16_t q; uint8_t i; } meshVertex;
+
+  // Triangle edge, the first pixel on or right of the edge in the current row is x + (r > 0)
+  typedef struct { int32_t x, r, dx, dr, d; } meshEdge;
+
+  typedef struct { int32_t z; uint16_t f; } meshOrder;
+
+  bool     reserve(uint16_t nv, uint16_t nf);
+  uint8_t  light(int32_t nx, int32_t ny, int32_t nz, int32_t len);
+  void     setEdge(meshEdge *e, const meshVertex *a, const meshVertex *b, int32_t y);
+  void     stepEdge(meshEdge *e);
+  void     drawFace(const meshVertex *a, const meshVertex *b, const meshVertex *c, uint16_t color, bool gouraud);
+
+  TFT_eSprite *_spr;
+  uint16_t   *_img, *_depth;        // Sprite pixels and depth buffer, nullptr if none
+  int32_t     _w, _h;
+  meshVertex *_vtx;                 // Work space for vertices and the face order
+  meshOrder  *_order;
+  uint16_t    _vtxSize, _orderSize;
+
+  int16_t     _cx, _cy;
+  uint16_t    _focal, _distance;
+  int16_t     _m[9];                // Rotation matrix, 1.0 = 16384
+  int16_t     _light[3];            // Unit light direction, 1.0 = 16384
+  uint8_t     _ambient, _shading;
+
+  int32_t     _x0, _y0, _x1, _y1;   // Area drawn, for Sprite dirty tracking
+};
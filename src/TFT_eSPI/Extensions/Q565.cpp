@@ -0,0 +1,229 @@
+/***************************************************************************************
+** Code for the Q565 image decoder
+** Each byte starts an operation: a colour from the table of recent colours, a small or
+** a larger change from the previous colour, a run of the previous colour or a new colour.
+** See Tools/img2q565/img2q565.py for the format
+***************************************************************************************/
+#define Q565_OP_DIFF  0x40
+#define Q565_OP_LUMA  0x80
+#define Q565_OP_RUN   0xC0
+#define Q565_OP_RGB   0xFE
+#define Q565_OP_LONG  0xFF
+
+#define Q565_HASH(c) ((((c) >> 11) * 3 + (((c) >> 5) & 0x3F) * 5 + ((c) & 0x1F) * 7) & 0x3F)
+
+TFT_eSPI_Q565::TFT_eSPI_Q565(void) {
+  _data   = nullptr;
+  _ptr    = nullptr;
+  _len    = 0;
+  _left   = 0;
+  _w = _h = 0;
+  _pixels = 0;
+  _run    = 0;
+  _prev   = 0;
+}
+
+bool TFT_eSPI_Q565::begin(const uint8_t *data, uint32_t len)
+{
+  _data = data;
+  _len  = len ? len : 0xFFFFFFFF;
+  return rewind();
+}
+
+uint16_t TFT_eSPI_Q565::width(void)
+{
+  return _w;
+}
+
+uint16_t TFT_eSPI_Q565::height(void)
+{
+  return _h;
+}
+
+// Read the header and reset the decoder state
+bool TFT_eSPI_Q565::rewind(void)
+{
+  _ptr    = _data;
+  _left   = _data ? _len : 0;
+  _w = _h = 0;
+  _pixels = 0;
+  _run    = 0;
+  _prev   = 0;
+  memset(_index, 0, sizeof(_index));
+
+  if ((_left < 8) || (next() != 'Q') || (next() != '5') || (next() != '6') || (next() != '5')) {
+    _left = 0;
+    return false;
+  }
+
+  _w  = next() << 8; _w |= next();
+  _h  = next() << 8; _h |= next();
+  _pixels = (uint32_t)_w * _h;
+
+  return true;
+}
+
+// Next data byte, 0 after the end
+uint8_t TFT_eSPI_Q565::next(void)
+{
+  if (!_left) return 0;
+  _left--;
+  return pgm_read_byte(_ptr++);
+}
+
+uint32_t TFT_eSPI_Q565::read(uint16_t *buf, uint32_t n, bool swap)
+{
+  if (n > _pixels) n = _pixels;
+
+  uint16_t prev  = _prev;
+  uint32_t count = 0;
+
+  while (count < n) {
+    // Output a run a block at a time
+    if (_run) {
+      uint32_t k = n - count;
+      if (k > _run) k = _run;
+      uint16_t c = swap ? (prev << 8 | prev >> 8) : prev;
+      _run  -= k;
+      count += k;
+      while (k--) *buf++ = c;
+      continue;
+    }
+
+    if (!_left) break; // Data is short
+
+    uint8_t  op = next();
+    uint16_t c;
+
+    if (op < Q565_OP_DIFF) c = _index[op];
+    else if (op < Q565_OP_LUMA) {
+      // Red, green and blue change by -2 to +1, each wraps within its field
+      uint16_t r = ((prev >> 11) + ((op >> 4) & 3) - 2) & 0x1F;
+      uint16_t g = (((prev >> 5) & 0x3F) + ((op >> 2) & 3) - 2) & 0x3F;
+      uint16_t b = ((prev & 0x1F) + (op & 3) - 2) & 0x1F;
+      c = r << 11 | g << 5 | b;
+    }
+    else if (op < Q565_OP_RUN) {
+      // Green changes by -32 to +31, red and blue by half that plus -8 to +7
+      int16_t  dg = (op & 0x3F) - 32;
+      int16_t  dh = dg >> 1;
+      uint8_t  rb = next();
+      uint16_t r = ((prev >> 11) + dh + (rb >> 4) - 8) & 0x1F;
+      uint16_t g = (((prev >> 5) & 0x3F) + dg) & 0x3F;
+      uint16_t b = ((prev & 0x1F) + dh + (rb & 0x0F) - 8) & 0x1F;
+      c = r << 11 | g << 5 | b;
+    }
+    else if (op == Q565_OP_RGB) {
+      c = next() << 8; c |= next();
+    }
+    else {
+      if (op == Q565_OP_LONG) { _run = next() << 8; _run |= next(); _run += 63; }
+      else _run = (op & 0x3F) + 1;
+      continue;
+    }
+
+    _index[Q565_HASH(c)] = c;
+    prev = c;
+    *buf++ = swap ? (c << 8 | c >> 8) : c;
+    count++;
+  }
+
+  _prev    = prev;
+  _pixels -= count;
+
+  return count;
+}
+
+bool TFT_eSPI_Q565::drawImage(TFT_eSPI *tft, int32_t x, int32_t y, bool dma)
+{
+  if (!tft || !rewind()) return false;
+
+  // Visible area in screen coordinates
+  int32_t cx = x, cy = y, cw = _w, ch = _h;
+  if (!tft->clipAddrWindow(&cx, &cy, &cw, &ch)) return true;
+
+  // Position of the visible area in the image
+  int32_t sx = cx - x - tft->getViewportX();
+  int32_t sy = cy - y - tft->getViewportY();
+
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+  dma = dma && tft->DMA_Enabled && (ch > 1);
+#else
+  dma = false;
+#endif
+
+  // Image width comes from the data, so the line buffer is on the heap. DMA needs a word
+  // aligned start, so DMA lines are decoded one pixel in when sx is odd
+  uint32_t stride = dma ? (_w + 2) & ~1 : _w;
+  uint16_t *lineBuf = (uint16_t*)malloc((stride * 2) << dma);
+  if (!lineBuf) return false;
+
+  // Lines above the visible area are decoded and dropped
+  while (sy--) read(lineBuf, _w, true);
+
+  bool swap = tft->getSwapBytes();
+  tft->setSwapBytes(false); // Lines are decoded byte swapped
+
+  // As for pushImage(), a transaction started by the sketch is left open
+  tft->begin_tft_write();
+  tft->inTransaction = true;
+
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+  if (dma) {
+    tft->setAddrWindowDMA(cx, cy, cw, ch);
+    for (int32_t i = 0; i < ch; i++) {
+      uint16_t *buf = lineBuf + (i & 1) * stride;
+      tft->dmaFence(buf, stride * 2); // Wait only if this buffer is still being sent
+      read(buf + (sx & 1), _w, true);
+      tft->pushPixelsDMA(buf + (sx & 1) + sx, cw);
+    }
+    tft->dmaWait(); // Line buffers are about to be freed
+  }
+  else
+#endif
+  {
+    tft->setAddrWindow(cx, cy, cw, ch);
+    while (ch--) {
+      read(lineBuf, _w, true);
+      tft->pushPixels(lineBuf + sx, cw);
+    }
+  }
+
+  tft->inTransaction = tft->lockTransaction;
+  tft->end_tft_write();
+
+  tft->setSwapBytes(swap);
+  free(lineBuf);
+  return true;
+}
+
+bool TFT_eSPI_Q565::drawImage(TFT_eSprite *spr, int32_t x, int32_t y)
+{
+  if (!spr || !spr->created() || !rewind()) return false;
+
+  int32_t cx = x, cy = y, cw = _w, ch = _h;
+  if (!spr->clipAddrWindow(&cx, &cy, &cw, &ch)) return true;
+
+  // Whole image visible in an unrotated 16bpp Sprite, decode into Sprite memory. Without
+  // rotation the clipped cx,cy are Sprite memory coordinates, lines are _iwidth apart
+  if ((spr->getColorDepth() == 16) && (spr->getRotation() == 0) && (cw == _w) && (ch == _h)) {
+    int32_t   sw  = spr->_iwidth;
+    uint16_t *img = (uint16_t*)spr->getFramePointer() + cx + cy * sw;
+    for (int32_t i = 0; i < _h; i++, img += sw) read(img, _w, true);
+    spr->markDirty(x, y, _w, _h);
+    return true;
+  }
+
+  // Otherwise write the lines down to the last visible one, they are clipped
+  uint16_t *lineBuf = (uint16_t*)malloc(_w * 2);
+  if (!lineBuf) return false;
+
+  int32_t  rows = cy - y - spr->getViewportY() + ch;
+  for (int32_t i = 0; i < rows; i++) {
+    read(lineBuf, _w, false);
+    spr->writeSpan(x, y + i, _w, lineBuf);
+  }
+
+  free(lineBuf);
+  return true;
+}
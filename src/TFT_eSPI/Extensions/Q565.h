@@ -0,0 +1,42 @@
+/***************************************************************************************
+// Q565 image decoder. Q565 is a lossless compressed RGB565 format in the style of QOI,
+// images are converted with Tools/img2q565. Lines are decoded as they are drawn to the
+// TFT or a Sprite, so only one or two lines of RAM are needed whatever the image size.
+***************************************************************************************/
+
+class TFT_eSPI_Q565
+{
+ public:
+  TFT_eSPI_Q565(void);
+
+  // Start decoding len bytes of image data in FLASH (PROGMEM) or RAM, len may be 0 if not
+  // known but then corrupt data is not detected. Returns false if it is not a Q565 image
+  bool     begin(const uint8_t *data, uint32_t len = 0);
+  uint16_t width(void);
+  uint16_t height(void);
+
+  // Decode the next n pixels into buf, rows follow each other. With swap true the colours
+  // are byte swapped as held in a Sprite or sent by pushPixels() with setSwapBytes(false).
+  // Returns the number of pixels decoded, less than n at the end of the image or the data
+  uint32_t read(uint16_t *buf, uint32_t n, bool swap = false);
+
+  // Draw the image with the top left corner at x,y, it is decoded from the start. On the
+  // TFT each line is sent as it is decoded, with dma true it is sent with DMA while the next
+  // line is decoded (call tft.startWrite() first as for pushImageDMA()). A line buffer is
+  // allocated while drawing, two for DMA. Returns false if there is not enough memory
+  bool     drawImage(TFT_eSPI *tft, int32_t x, int32_t y, bool dma = false);
+  // In a 16bpp Sprite an image that fits is decoded straight into Sprite memory
+  bool     drawImage(TFT_eSprite *spr, int32_t x, int32_t y);
+
+ private:
+  bool     rewind(void);
+  uint8_t  next(void);
+
+  const uint8_t *_data, *_ptr;
+  uint32_t _len, _left;      // Data length and bytes not yet read
+  uint16_t _w, _h;
+  uint32_t _pixels;          // Pixels not yet decoded
+  uint32_t _run;             // Repeats of _prev not yet output
+  uint16_t _prev;            // Last colour decoded
+  uint16_t _index[64];       // Colours seen, at the position given by their hash
+};
@@ -0,0 +1,334 @@
+/***************************************************************************************
+** Code for the numeric readout UI element
+** Values are formatted without String or floating point printf, and only the character
+** cells that change are redrawn
+***************************************************************************************/
+TFT_eSPI_Readout::TFT_eSPI_Readout(void) {
+  _gfx       = nullptr;
+  _spr       = nullptr;
+#ifdef LOAD_GFXFF
+  _gfxFont   = nullptr;
+#endif
+  _x = _y    = 0;
+  _cellW     = 0;
+  _dotW      = 0;
+  _h         = 0;
+  _fgcolor   = TFT_WHITE;
+  _bgcolor   = TFT_BLACK;
+  _width     = 0;
+  _decimals  = 0;
+  _font      = 1;
+  _datum     = TL_DATUM;
+  _textsize  = 1;
+  _zeroPad   = false;
+  _useSprite = false;
+  _dma       = false;
+  invalidate();
+}
+
+TFT_eSPI_Readout::~TFT_eSPI_Readout(void) {
+  if (_spr) delete _spr;
+}
+
+void TFT_eSPI_Readout::init(TFT_eSPI *gfx, int32_t x, int32_t y, uint8_t width, uint8_t decimals,
+ uint8_t font, uint8_t datum)
+{
+  if (width > READOUT_MAX_CELLS) width = READOUT_MAX_CELLS;
+  if (decimals > 7) decimals = 7;
+  if (decimals && (width < decimals + 2)) width = decimals + 2; // Room for "0." at least
+
+  _gfx      = gfx;
+  _x        = x;
+  _y        = y;
+  _width    = width;
+  _decimals = decimals;
+  _font     = font;
+  _datum    = datum;
+  invalidate();
+}
+
+#ifdef LOAD_GFXFF
+void TFT_eSPI_Readout::setFreeFont(const GFXfont *f)
+{
+  _gfxFont = f;
+  invalidate();
+}
+#endif
+
+void TFT_eSPI_Readout::setTextSize(uint8_t size)
+{
+  _textsize = size ? size : 1;
+  invalidate();
+}
+
+void TFT_eSPI_Readout::setTextColor(uint16_t fgcolor, uint16_t bgcolor)
+{
+  if ((fgcolor == _fgcolor) && (bgcolor == _bgcolor)) return;
+  _fgcolor = fgcolor;
+  _bgcolor = bgcolor;
+  invalidate();
+}
+
+void TFT_eSPI_Readout::setZeroPad(bool zeroPad)
+{
+  _zeroPad = zeroPad;
+}
+
+bool TFT_eSPI_Readout::useSprite(bool enable, bool dma)
+{
+  _useSprite = enable;
+  _dma       = dma;
+  invalidate();
+
+  if (!enable) {
+    if (_spr) delete _spr;
+    _spr = nullptr;
+    return true;
+  }
+
+  if (!_gfx) return false;
+
+  // Create the Sprite now so failure can be reported, the TFT font is then restored
+  uint8_t tempfont = _gfx->textfont;
+  uint8_t tempsize = _gfx->textsize;
+#ifdef LOAD_GFXFF
+  GFXfont *tempgfxFont = _gfx->gfxFont;
+  if (_gfxFont) _gfx->setFreeFont(_gfxFont);
+#endif
+  _gfx->setTextSize(_textsize);
+  setMetrics();
+
+  _gfx->textfont = tempfont;
+  _gfx->textsize = tempsize;
+#ifdef LOAD_GFXFF
+  _gfx->gfxFont  = tempgfxFont;
+#endif
+
+  return _spr && _spr->created();
+}
+
+// Cell sizes are found again on the next draw as the font may have been changed
+void TFT_eSPI_Readout::invalidate(void)
+{
+  _cellW = 0;
+  memset(_shown, 0, sizeof(_shown));
+}
+
+uint8_t TFT_eSPI_Readout::drawFloat(float value)
+{
+  if (isnan(value)) return drawCells(0, false);
+
+  float scaled = value;
+  for (uint8_t i = 0; i < _decimals; i++) scaled *= 10.0;
+
+  // 1e18 is beyond any field, avoids an undefined conversion
+  if ((scaled >= 1e18) || (scaled <= -1e18)) return drawCells(0, false);
+
+  return drawCells((int64_t)(scaled < 0 ? scaled - 0.5 : scaled + 0.5), true);
+}
+
+uint8_t TFT_eSPI_Readout::drawNumber(long value)
+{
+  int64_t scaled = value;
+  for (uint8_t i = 0; i < _decimals; i++) scaled *= 10;
+
+  return drawCells(scaled, true);
+}
+
+// Fill text with _width characters, value right justified. Digit cells are dashes if the
+// value does not fit
+void TFT_eSPI_Readout::format(int64_t scaled, bool valid, char *text)
+{
+  bool     negative = (scaled < 0);
+  uint64_t u = negative ? -(uint64_t)scaled : scaled;
+  int8_t   pos = _width - 1;
+
+  if (valid) {
+    for (uint8_t i = 0; i < _decimals; i++) { text[pos--] = '0' + u % 10; u /= 10; }
+    if (_decimals) text[pos--] = '.';
+
+    // At least one integer digit
+    do { text[pos--] = '0' + u % 10; u /= 10; } while (u && (pos >= 0));
+
+    if (_zeroPad) while (pos >= negative) text[pos--] = '0';
+
+    if (negative) {
+      if (pos < 0) u = 1;  // No room for sign
+      else text[pos--] = '-';
+    }
+
+    while (pos >= 0) text[pos--] = ' ';
+  }
+
+  if (!valid || u) {
+    for (pos = 0; pos < _width; pos++) text[pos] = '-';
+    if (_decimals) text[_width - _decimals - 1] = '.';
+  }
+}
+
+// Cells are as wide as the widest digit or minus sign, the decimal point has its own width
+void TFT_eSPI_Readout::setMetrics(void)
+{
+  char str[2] = { 0, 0 };
+  const char *chars = "0123456789-";
+
+  _cellW = 1;
+  while (*chars) {
+    str[0] = *chars++;
+    int16_t w = _gfx->textWidth(str, _font);
+    if (w > _cellW) _cellW = w;
+  }
+
+  _dotW = _gfx->textWidth(".", _font);
+  _h    = _gfx->fontHeight(_font);
+  if (_h < 1) _h = 1;
+
+  if (!_useSprite) return;
+
+  if (!_spr) _spr = new TFT_eSprite(_gfx);
+  if (!_spr) return;
+
+  if ((_spr->width() != _cellW) || (_spr->height() != _h)) {
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+    if (_dma) _gfx->dmaWait(); // Sprite may still be being sent
+#endif
+    _spr->deleteSprite();
+    _spr->setColorDepth(16);
+    _spr->setAttribute(PSRAM_ENABLE, false); // DMA capable RAM
+    _spr->createSprite(_cellW, _h);
+  }
+}
+
+uint8_t TFT_eSPI_Readout::drawCells(int64_t scaled, bool valid)
+{
+  if (!_gfx || !_width) return 0;
+
+  char text[READOUT_MAX_CELLS];
+  format(scaled, valid, text);
+
+  // Text state changed here is restored before return
+  uint8_t  tempfont    = _gfx->textfont;
+  uint8_t  tempsize    = _gfx->textsize;
+  uint8_t  tempdatum   = _gfx->getTextDatum();
+  uint16_t tempPadding = _gfx->getTextPadding();
+  uint32_t tempfg      = _gfx->textcolor;
+  uint32_t tempbg      = _gfx->textbgcolor;
+  bool     tempfill    = _gfx->_fillbg;
+
+  // Select the font on the TFT
+#ifdef LOAD_GFXFF
+  GFXfont *tempgfxFont = _gfx->gfxFont;
+  if (_gfxFont) _gfx->setFreeFont(_gfxFont);
+#endif
+  _gfx->setTextSize(_textsize);
+  if (!_cellW) setMetrics();
+
+  // Field top left corner from the datum, baseline datums use the field bottom
+  int32_t w = _cellW * (_width - (_decimals > 0)) + (_decimals ? _dotW : 0);
+  int32_t x = _x, y = _y;
+
+  if      (_datum % 3 == 1) x -= w / 2;
+  else if (_datum % 3 == 2) x -= w;
+  if      (_datum / 3 == 1) y -= _h / 2;
+  else if (_datum / 3 >= 2) y -= _h;
+
+  _gfx->setTextDatum(TL_DATUM);
+  _gfx->setTextColor(_fgcolor, _bgcolor, true);
+
+  // One transaction for all cells, as for pushImage(). A transaction opened by the sketch
+  // with startWrite() stays open. The non-inlined calls do nothing for a Sprite
+  _gfx->begin_nin_write();
+  _gfx->inTransaction = true;
+
+  uint8_t drawn = 0;
+  uint8_t dot = _decimals ? _width - _decimals - 1 : READOUT_MAX_CELLS;
+
+  for (uint8_t i = 0; i < _width; i++) {
+    int32_t cw = (i == dot) ? _dotW : _cellW;
+    if (text[i] != _shown[i]) {
+      drawCell(x, y, cw, text[i]);
+      _shown[i] = text[i];
+      drawn++;
+    }
+    x += cw;
+  }
+
+  _gfx->inTransaction = _gfx->lockTransaction;
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+  if (!_gfx->inTransaction) _gfx->dmaWait(); // Last cell must be sent before the bus is released
+#endif
+  _gfx->end_nin_write();
+
+  _gfx->textfont    = tempfont;
+  _gfx->textsize    = tempsize;
+  _gfx->textcolor   = tempfg;
+  _gfx->textbgcolor = tempbg;
+  _gfx->_fillbg     = tempfill;
+#ifdef LOAD_GFXFF
+  _gfx->gfxFont     = tempgfxFont;
+#endif
+  _gfx->setTextDatum(tempdatum);
+  _gfx->setTextPadding(tempPadding);
+
+  return drawn;
+}
+
+// Draw one character centred in a cell, the whole cell is painted
+void TFT_eSPI_Readout::drawCell(int32_t x, int32_t y, int32_t w, char c)
+{
+  char str[2] = { c, 0 };
+
+  bool sprite = _spr && _spr->created() && (w == _cellW);
+#ifdef SMOOTH_FONT
+  if (_gfx->fontLoaded) sprite = false;
+#endif
+
+  if (sprite) {
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+    if (_dma) _gfx->dmaFence(_spr->getPointer(), _cellW * _h * 2); // Previous cell may still be being sent
+#endif
+    _spr->fillSprite(_bgcolor);
+    if (c != ' ') {
+#ifdef LOAD_GFXFF
+      if (_gfxFont) _spr->setFreeFont(_gfxFont);
+      else
+#endif
+      _spr->setTextFont(_font);
+      _spr->setTextSize(_textsize);
+      _spr->setTextColor(_fgcolor, _bgcolor, true);
+      _spr->drawString(str, (w - _spr->textWidth(str, _font)) / 2, 0, _font);
+    }
+
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+    if (_dma && _gfx->DMA_Enabled) {
+      bool swap = _gfx->getSwapBytes();
+      _gfx->setSwapBytes(false); // Sprite pixels are stored byte swapped
+      _gfx->pushImageDMA(x, y, w, _h, (uint16_t*)_spr->getPointer());
+      _gfx->setSwapBytes(swap);
+      return;
+    }
+#endif
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+    if (_dma) _gfx->dmaWait(); // Earlier cells sent with DMA must end before the CPU draws
+#endif
+    _spr->pushSprite(x, y);
+    return;
+  }
+
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+  if (_dma) _gfx->dmaWait(); // Earlier cells sent with DMA must end before the CPU draws
+#endif
+
+  if (c == ' ') {
+    _gfx->fillRect(x, y, w, _h, _bgcolor);
+    return;
+  }
+
+  // Fill left of the character, padding fills to the right
+  int32_t ox = (w - _gfx->textWidth(str, _font)) / 2;
+  if (ox > 0) _gfx->fillRect(x, y, ox, _h, _bgcolor);
+  else ox = 0;
+
+  _gfx->setTextPadding(w - ox);
+  _gfx->drawString(str, x + ox, y, _font);
+}
@@ -0,0 +1,61 @@
+/***************************************************************************************
+// Numeric readout class. A value is shown in a field of fixed width character cells,
+// only the cells whose character has changed since the last draw are redrawn. Cells
+// have the width of the widest digit so values do not jiggle as they change.
+***************************************************************************************/
+
+// Maximum number of character cells in a readout field
+#define READOUT_MAX_CELLS 12
+
+class TFT_eSPI_Readout
+{
+ public:
+  TFT_eSPI_Readout(void);
+  ~TFT_eSPI_Readout(void);
+
+  // Field of "width" characters including the sign and decimal point (as for printf "%5.1f"),
+  // positioned on x,y with a drawString() datum, font is a font number as for drawString()
+  void     init(TFT_eSPI *gfx, int32_t x, int32_t y, uint8_t width, uint8_t decimals = 0,
+                uint8_t font = 1, uint8_t datum = TL_DATUM);
+
+#ifdef LOAD_GFXFF
+  // Use a GFX Free Font (font number 1), it is selected on the TFT when the field is drawn
+  void     setFreeFont(const GFXfont *f);
+#endif
+  void     setTextSize(uint8_t size);
+  void     setTextColor(uint16_t fgcolor, uint16_t bgcolor);
+  // Fill unused leading cells with zeros, as for printf "%03d"
+  void     setZeroPad(bool zeroPad);
+
+  // Draw changed cells in a Sprite of one cell so each is sent in one window, with dma true
+  // 16bpp cells are sent with DMA. The DMA has ended when a draw returns unless the sketch
+  // has called tft.startWrite(). Smooth fonts are drawn directly. Returns false if the
+  // Sprite cannot be created
+  bool     useSprite(bool enable, bool dma = false);
+
+  // Redraw every cell next time, e.g. after the screen has been cleared
+  void     invalidate(void);
+
+  // Show a value, returns the number of cells redrawn (0 if nothing changed). Values that
+  // do not fit, and NaN, are shown as dashes
+  uint8_t  drawFloat(float value);
+  uint8_t  drawNumber(long value);
+
+ private:
+  uint8_t  drawCells(int64_t scaled, bool valid);
+  void     format(int64_t scaled, bool valid, char *text);
+  void     setMetrics(void);
+  void     drawCell(int32_t x, int32_t y, int32_t w, char c);
+
+  TFT_eSPI    *_gfx;
+  TFT_eSprite *_spr;         // One cell Sprite, nullptr if not used
+#ifdef LOAD_GFXFF
+  const GFXfont *_gfxFont;
+#endif
+  int32_t  _x, _y;           // Datum position
+  int16_t  _cellW, _dotW, _h; // Digit cell width, decimal point cell width and field height
+  uint16_t _fgcolor, _bgcolor;
+  uint8_t  _width, _decimals, _font, _datum, _textsize;
+  bool     _zeroPad, _useSprite, _dma;
+  char     _shown[READOUT_MAX_CELLS]; // Character in each cell, 0 = must be redrawn
+};
@@ -245,6 +245,93 @@ void TFT_eSPI::loadMetrics(void)
   gFont.yAdvance = gFont.maxAscent + gFont.maxDescent;
 
   gFont.spaceWidth = (gFont.ascent + gFont.descent) * 2/7;  // Guess at space width
+
+  buildUnicodeIndex();
+}
+
+
+/***************************************************************************************
+** Function name:           siftGlyph (static)
+** Description:             Heap sift-down of glyph numbers ordered by code then number
+***************************************************************************************/
+static void siftGlyph(uint16_t *idx, const uint16_t *code, int32_t root, int32_t n)
+{
+  uint16_t g = idx[root];
+  uint32_t key = ((uint32_t)code[g] << 16) | g;
+
+  while (true) {
+    int32_t child = 2 * root + 1;
+    if (child >= n) break;
+    uint32_t ckey = ((uint32_t)code[idx[child]] << 16) | idx[child];
+    if (child + 1 < n) {
+      uint32_t rkey = ((uint32_t)code[idx[child + 1]] << 16) | idx[child + 1];
+      if (rkey > ckey) { child++; ckey = rkey; }
+    }
+    if (ckey <= key) break;
+    idx[root] = idx[child];
+    root = child;
+  }
+  idx[root] = g;
+}
+
+
+/***************************************************************************************
+** Function name:           buildUnicodeIndex
+** Description:             Build the glyph lookup tables used by getUnicodeIndex
+***************************************************************************************/
+// Codes 0x00-0xFF are direct mapped by a 512 byte table. Other codes are found by binary
+// search, on gUnicode itself if the font lists glyphs in code order (as the Processing
+// and online vlw generators do), otherwise on a 2 byte per glyph index sorted here.
+// If memory runs out getUnicodeIndex falls back to a linear search.
+void TFT_eSPI::buildUnicodeIndex(void)
+{
+  gHighFirst = 0;
+  gHighCount = 0;
+
+  gLatin = (uint16_t*)calloc(256, sizeof(uint16_t)); // Keep in internal RAM, it is hit for most characters
+  if (!gLatin) return;
+
+  bool sorted = true;
+
+  for (uint16_t i = 0; i < gFont.gCount; i++)
+  {
+    uint16_t code = gUnicode[i];
+    if (code < 0x100) {
+      if (gLatin[code] == 0) gLatin[code] = i + 1; // First match wins, as for a linear search
+    }
+    else gHighCount++;
+    if (i && code < gUnicode[i - 1]) sorted = false;
+  }
+
+  if (sorted) {
+    gHighFirst = gFont.gCount - gHighCount;
+    return;
+  }
+
+  if (gHighCount == 0) return;
+
+#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
+  if ( psramFound() ) gSorted = (uint16_t*)ps_malloc( gHighCount * 2);
+  else
+#endif
+  gSorted = (uint16_t*)malloc( gHighCount * 2);
+
+  if (!gSorted) {
+    free(gLatin);
+    gLatin = NULL;
+    gHighCount = 0;
+    return;
+  }
+
+  uint16_t n = 0;
+  for (uint16_t i = 0; i < gFont.gCount; i++) if (gUnicode[i] > 0xFF) gSorted[n++] = i;
+
+  // Heap sort, in place with no recursion, ties are kept in glyph order by the sort key
+  for (int32_t i = n / 2 - 1; i >= 0; i--) siftGlyph(gSorted, gUnicode, i, n);
+  for (int32_t i = n - 1; i > 0; i--) {
+    uint16_t g = gSorted[0]; gSorted[0] = gSorted[i]; gSorted[i] = g;
+    siftGlyph(gSorted, gUnicode, 0, i);
+  }
 }
 
 
@@ -296,6 +383,24 @@ void TFT_eSPI::unloadFont( void )
     gBitmap = NULL;
   }
 
+  if (gLatin)
+  {
+    free(gLatin);
+    gLatin = NULL;
+  }
+
+  if (gSorted)
+  {
+    free(gSorted);
+    gSorted = NULL;
+  }
+
+  gHighFirst = 0;
+  gHighCount = 0;
+
+  clearGlyphCache();
+  freeGlyphAtlas();
+
   gFont.gArray = nullptr;
 
 #ifdef FONT_FS_AVAILABLE
@@ -306,6 +411,72 @@ void TFT_eSPI::unloadFont( void )
 }
 
 
+/***************************************************************************************
+** Function name:           shareFont
+** Description:             Lend the loaded font to another instance, or take it back
+*************************************************************************************x*/
+// Used by the text line buffer so its Sprite draws with this font without a copy. When the
+// font is taken back the cache and atlas state is returned and dst no longer has a font
+void TFT_eSPI::shareFont(TFT_eSPI *dst, bool share)
+{
+  if (share)
+  {
+    dst->gFont      = gFont;
+    dst->gUnicode   = gUnicode;
+    dst->gHeight    = gHeight;
+    dst->gWidth     = gWidth;
+    dst->gxAdvance  = gxAdvance;
+    dst->gdY        = gdY;
+    dst->gdX        = gdX;
+    dst->gBitmap    = gBitmap;
+    dst->gLatin     = gLatin;
+    dst->gSorted    = gSorted;
+    dst->gHighFirst = gHighFirst;
+    dst->gHighCount = gHighCount;
+#ifdef FONT_FS_AVAILABLE
+    dst->fontFile   = fontFile;
+    dst->spiffs     = spiffs;
+    dst->fs_font    = fs_font;
+#endif
+    dst->gcHead   = gcHead;   dst->gcTail   = gcTail;
+    dst->gcBucket = gcBucket;
+    dst->gcBudget = gcBudget; dst->gcUsed   = gcUsed;
+    dst->gcHits   = gcHits;   dst->gcMisses = gcMisses;
+    dst->gaPixels = gaPixels; dst->gaIndex  = gaIndex;
+    dst->gaBudget = gaBudget; dst->gaSize   = gaSize;
+    dst->gaUsed   = gaUsed;   dst->gaGlyphs = gaGlyphs;
+    dst->gaFg     = gaFg;     dst->gaBg     = gaBg;
+    dst->fontLoaded = true;
+    return;
+  }
+
+  // The cache and atlas may have been updated while drawing
+  gcHead   = dst->gcHead;   gcTail   = dst->gcTail;
+  gcBucket = dst->gcBucket; gcUsed   = dst->gcUsed;
+  gcHits   = dst->gcHits;   gcMisses = dst->gcMisses;
+  gaPixels = dst->gaPixels; gaIndex  = dst->gaIndex;
+  gaSize   = dst->gaSize;   gaUsed   = dst->gaUsed;
+  gaGlyphs = dst->gaGlyphs;
+  gaFg     = dst->gaFg;     gaBg     = dst->gaBg;
+
+  dst->gUnicode = NULL; dst->gHeight = NULL; dst->gWidth  = NULL; dst->gxAdvance = NULL;
+  dst->gdY      = NULL; dst->gdX     = NULL; dst->gBitmap = NULL;
+  dst->gLatin   = NULL; dst->gSorted = NULL;
+  dst->gHighFirst = 0;  dst->gHighCount = 0;
+#ifdef FONT_FS_AVAILABLE
+  dst->fontFile = fs::File();
+#endif
+  dst->gcHead   = nullptr; dst->gcTail  = nullptr;
+  dst->gcBucket = nullptr;
+  dst->gcBudget = 0;       dst->gcUsed  = 0;
+  dst->gaPixels = nullptr; dst->gaIndex = nullptr;
+  dst->gaBudget = 0;       dst->gaSize  = 0;
+  dst->gaUsed   = 0;       dst->gaGlyphs = 0;
+  dst->gFont.gArray = nullptr;
+  dst->fontLoaded = false;
+}
+
+
 /***************************************************************************************
 ** Function name:           readInt32
 ** Description:             Get a 32-bit integer from the font file
@@ -340,6 +511,34 @@ uint32_t TFT_eSPI::readInt32(void)
 *************************************************************************************x*/
 bool TFT_eSPI::getUnicodeIndex(uint16_t unicode, uint16_t *index)
 {
+  if (gLatin)
+  {
+    if (unicode < 0x100) {
+      uint16_t g = gLatin[unicode];
+      if (g == 0) return false;
+      *index = g - 1;
+      return true;
+    }
+
+    // Binary search for the first glyph with a code >= unicode
+    uint16_t lo = 0, hi = gHighCount;
+    while (lo < hi) {
+      uint16_t mid = (lo + hi) >> 1;
+      uint16_t g = gSorted ? gSorted[mid] : gHighFirst + mid;
+      if (gUnicode[g] < unicode) lo = mid + 1;
+      else hi = mid;
+    }
+    if (lo < gHighCount) {
+      uint16_t g = gSorted ? gSorted[lo] : gHighFirst + lo;
+      if (gUnicode[g] == unicode) {
+        *index = g;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // No index (out of memory when the font was loaded) so search all glyphs
   for (uint16_t i = 0; i < gFont.gCount; i++)
   {
     if (gUnicode[i] == unicode)
@@ -352,6 +551,322 @@ bool TFT_eSPI::getUnicodeIndex(uint16_t unicode, uint16_t *index)
 }
 
 
+/***************************************************************************************
+** Function name:           unicodeIndexSize
+** Description:             Return the RAM in bytes used by the Unicode lookup index
+***************************************************************************************/
+// 512 bytes for the 0x00-0xFF table, plus 2 bytes per glyph above 0xFF only if the font
+// glyphs are not in code order
+uint32_t TFT_eSPI::unicodeIndexSize(void)
+{
+  if (!gLatin) return 0;
+  return 256 * sizeof(uint16_t) + (gSorted ? gHighCount * sizeof(uint16_t) : 0);
+}
+
+
+/***************************************************************************************
+** Function name:           setGlyphCache
+** Description:             Set the glyph bitmap cache size in bytes, 0 = no cache
+***************************************************************************************/
+// Each entry costs the glyph width * height plus a small header. Glyphs larger than the
+// whole cache are read from the file each time, as they are with no cache.
+void TFT_eSPI::setGlyphCache(uint32_t bytes)
+{
+  gcBudget = bytes;
+
+  // Evict least recently used glyphs to fit the new size
+  while (gcTail && gcUsed > gcBudget) evictGlyph();
+
+  gcHits   = 0;
+  gcMisses = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           clearGlyphCache
+** Description:             Free all cached glyph bitmaps, the cache size is kept
+***************************************************************************************/
+void TFT_eSPI::clearGlyphCache(void)
+{
+  while (gcHead) {
+    glyphCacheEntry* e = gcHead;
+    gcHead = e->next;
+    free(e);
+  }
+  gcTail = nullptr;
+  gcUsed = 0;
+
+  if (gcBucket) free(gcBucket);
+  gcBucket = nullptr;
+}
+
+
+/***************************************************************************************
+** Function name:           evictGlyph
+** Description:             Free the least recently used glyph in the cache
+***************************************************************************************/
+void TFT_eSPI::evictGlyph(void)
+{
+  glyphCacheEntry* e = gcTail;
+  if (!e) return;
+
+  gcTail = e->prev;
+  if (gcTail) gcTail->next = nullptr;
+  else gcHead = nullptr;
+
+  // Unlink from the hash bucket, buckets hold few entries
+  glyphCacheEntry** h = gcBucket + (e->gNum & (GLYPH_CACHE_BUCKETS - 1));
+  while (*h != e) h = &(*h)->hnext;
+  *h = e->hnext;
+
+  gcUsed -= sizeof(glyphCacheEntry) + e->size;
+  free(e);
+}
+
+
+/***************************************************************************************
+** Function name:           cachedGlyph
+** Description:             Return a pointer to a glyph bitmap in the cache, nullptr if none
+***************************************************************************************/
+// Reads the glyph from the font file on a miss. Returns nullptr if the font is not a file,
+// the cache is off or the glyph cannot be cached, the caller then reads the file itself.
+// SD card fonts are read here in one go, so call before starting a TFT transaction.
+const uint8_t* TFT_eSPI::cachedGlyph(uint16_t gNum)
+{
+#ifdef FONT_FS_AVAILABLE
+  if (!fs_font || gcBudget == 0) return nullptr;
+
+  // Find the glyph in its hash bucket, move it to the front of the list on a hit
+  glyphCacheEntry* e = gcBucket ? gcBucket[gNum & (GLYPH_CACHE_BUCKETS - 1)] : nullptr;
+  while (e && e->gNum != gNum) e = e->hnext;
+
+  if (e)
+  {
+    gcHits++;
+    if (e != gcHead) {
+      e->prev->next = e->next;
+      if (e->next) e->next->prev = e->prev;
+      else gcTail = e->prev;
+      e->prev = nullptr;
+      e->next = gcHead;
+      gcHead->prev = e;
+      gcHead = e;
+    }
+    return (const uint8_t*)(e + 1);
+  }
+
+  gcMisses++;
+
+  uint16_t size = gWidth[gNum] * gHeight[gNum];
+  uint32_t need = sizeof(glyphCacheEntry) + size;
+  if (need > gcBudget) return nullptr;
+
+  if (!gcBucket) {
+    gcBucket = (glyphCacheEntry**)calloc(GLYPH_CACHE_BUCKETS, sizeof(glyphCacheEntry*));
+    if (!gcBucket) return nullptr;
+  }
+
+  while (gcTail && gcUsed + need > gcBudget) evictGlyph();
+
+#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
+  if ( psramFound() ) e = (glyphCacheEntry*)ps_malloc(need);
+  else
+#endif
+  e = (glyphCacheEntry*)malloc(need);
+  if (!e) return nullptr;
+
+  fontFile.seek(gBitmap[gNum], fs::SeekSet);
+  if (fontFile.read((uint8_t*)(e + 1), size) != size) {
+    free(e);
+    return nullptr;
+  }
+
+  e->gNum = gNum;
+  e->size = size;
+  e->prev = nullptr;
+  e->next = gcHead;
+  if (gcHead) gcHead->prev = e;
+  else gcTail = e;
+  gcHead = e;
+  gcUsed += need;
+
+  glyphCacheEntry** h = gcBucket + (gNum & (GLYPH_CACHE_BUCKETS - 1));
+  e->hnext = *h;
+  *h = e;
+
+  return (const uint8_t*)(e + 1);
+#else
+  gNum = gNum; // Avoid unused variable warning
+  return nullptr;
+#endif
+}
+
+
+/***************************************************************************************
+** Function name:           prefetchGlyphs
+** Description:             Read the glyphs of a string into the glyph cache
+***************************************************************************************/
+void TFT_eSPI::prefetchGlyphs(const char *string)
+{
+  if (!fontLoaded || gcBudget == 0 || string == nullptr) return;
+
+  uint16_t len = strlen(string);
+  uint16_t n = 0;
+
+  while (n < len)
+  {
+    uint16_t unicode = decodeUTF8((uint8_t*)string, &n, len - n);
+    uint16_t gNum = 0;
+    if (unicode > 0x20 && getUnicodeIndex(unicode, &gNum)) cachedGlyph(gNum);
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           getGlyphCacheStats
+** Description:             Return glyph cache hits, misses and bytes in use
+***************************************************************************************/
+void TFT_eSPI::getGlyphCacheStats(uint32_t *hits, uint32_t *misses, uint32_t *bytesUsed)
+{
+  if (hits)      *hits      = gcHits;
+  if (misses)    *misses    = gcMisses;
+  if (bytesUsed) *bytesUsed = gcUsed;
+}
+
+
+/***************************************************************************************
+** Function name:           setGlyphAtlas
+** Description:             Set the glyph atlas size in bytes, 0 = no atlas
+***************************************************************************************/
+// The size includes a 4 byte per glyph index, each glyph then needs width * height * 2
+// bytes. Memory is allocated when the first glyph is drawn. When the atlas is full
+// other glyphs are drawn by blending as before.
+void TFT_eSPI::setGlyphAtlas(uint32_t bytes)
+{
+  freeGlyphAtlas();
+  gaBudget = bytes;
+}
+
+
+/***************************************************************************************
+** Function name:           freeGlyphAtlas
+** Description:             Free the glyph atlas memory, the atlas size is kept
+***************************************************************************************/
+void TFT_eSPI::freeGlyphAtlas(void)
+{
+  if (gaPixels) free(gaPixels);
+  if (gaIndex)  free(gaIndex);
+  gaPixels = nullptr;
+  gaIndex  = nullptr;
+  gaSize   = 0;
+  gaUsed   = 0;
+  gaGlyphs = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           getGlyphAtlasStats
+** Description:             Return the number of glyphs in the atlas and bytes allocated
+***************************************************************************************/
+void TFT_eSPI::getGlyphAtlasStats(uint32_t *glyphs, uint32_t *bytesUsed)
+{
+  if (glyphs)    *glyphs = gaGlyphs;
+  if (bytesUsed) *bytesUsed = gaIndex ? gFont.gCount * 4 + gaSize * 2 : 0;
+}
+
+
+/***************************************************************************************
+** Function name:           atlasGlyph
+** Description:             Return a glyph image blended with fg and bg, nullptr if none
+***************************************************************************************/
+// Images are byte swapped ready for the display. Pixels outside the glyph shape are bg,
+// *inkIsBg is set if any glyph pixel also blends to bg, so bg cannot be used as a
+// transparent colour. Reads the font file on a miss so call before starting a transaction.
+const uint16_t* TFT_eSPI::atlasGlyph(uint16_t gNum, uint16_t fg, uint16_t bg, bool *inkIsBg)
+{
+  if (gaBudget == 0 || !fontLoaded) return nullptr;
+
+  if (!gaIndex)
+  {
+    uint32_t indexBytes = gFont.gCount * 4;
+    if (gaBudget <= indexBytes) return nullptr;
+    gaIndex = (uint32_t*)calloc(gFont.gCount, 4);
+    if (!gaIndex) return nullptr;
+    gaSize = (gaBudget - indexBytes) / 2;
+#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
+    if ( psramFound() ) gaPixels = (uint16_t*)ps_malloc(gaSize * 2);
+    else
+#endif
+    gaPixels = (uint16_t*)malloc(gaSize * 2);
+    if (!gaPixels) { freeGlyphAtlas(); return nullptr; }
+    gaFg = fg;
+    gaBg = bg;
+  }
+
+  // Invalidate the atlas if the colours have changed
+  if (fg != gaFg || bg != gaBg)
+  {
+    memset(gaIndex, 0, gFont.gCount * 4);
+    gaUsed   = 0;
+    gaGlyphs = 0;
+    gaFg = fg;
+    gaBg = bg;
+  }
+
+  uint32_t entry = gaIndex[gNum];
+  if (entry)
+  {
+    *inkIsBg = entry >> 31;
+    return gaPixels + (entry & 0x7FFFFFFF) - 1;
+  }
+
+  uint32_t size = gWidth[gNum] * gHeight[gNum];
+  if (size == 0 || gaUsed + size > gaSize) return nullptr;
+
+  uint16_t* img = gaPixels + gaUsed;
+  const uint8_t* alpha = (const uint8_t*)gFont.gArray + gBitmap[gNum];
+
+#ifdef FONT_FS_AVAILABLE
+  if (fs_font)
+  {
+    alpha = cachedGlyph(gNum);
+    if (!alpha) {
+      // Read the alpha values into the top half of the image space, the expansion to 16 bits
+      // below reads each alpha value before the pixel written overlaps it
+      alpha = (uint8_t*)img + size;
+      fontFile.seek(gBitmap[gNum], fs::SeekSet);
+      if (fontFile.read((uint8_t*)alpha, size) != size) return nullptr;
+    }
+  }
+#endif
+
+  bool ink = false;
+  uint16_t fgs = fg << 8 | fg >> 8;
+  uint16_t bgs = bg << 8 | bg >> 8;
+
+  for (uint32_t i = 0; i < size; i++)
+  {
+    uint8_t a = pgm_read_byte(alpha + i);
+    uint16_t color;
+    if (a == 0) { img[i] = bgs; continue; }
+    if (a == 0xFF) color = fgs;
+    else {
+      color = alphaBlend(a, fg, bg);
+      color = color << 8 | color >> 8;
+    }
+    if (color == bgs) ink = true;
+    img[i] = color;
+  }
+
+  gaUsed += size;
+  gaGlyphs++;
+  gaIndex[gNum] = (img - gaPixels + 1) | ((uint32_t)ink << 31);
+
+  *inkIsBg = ink;
+  return img;
+}
+
+
 /***************************************************************************************
 ** Function name:           drawGlyph
 ** Description:             Write a character to the TFT cursor position
@@ -405,13 +920,26 @@ void TFT_eSPI::drawGlyph(uint16_t code)
     if (cursor_x == 0) cursor_x -= gdX[gNum];
 
     uint8_t* pbuffer = nullptr;
-    const uint8_t* gPtr = (const uint8_t*) gFont.gArray;
+    const uint8_t* gPtr = (const uint8_t*) gFont.gArray + gBitmap[gNum];
+
+    // Copy the glyph from the atlas unless it overlaps the previous glyph background
+    const uint16_t* aPtr = nullptr;
+    bool inkIsBg = false;
+    if (gaBudget && !getColor && !(_fillbg && bg_cursor_x > cursor_x + gdX[gNum]))
+    {
+      aPtr = atlasGlyph(gNum, fg, bg, &inkIsBg);
+      // bg is the transparent colour when the background is not filled
+      if (inkIsBg && !_fillbg) aPtr = nullptr;
+    }
 
 #ifdef FONT_FS_AVAILABLE
-    if (fs_font)
+    if (fs_font && !aPtr)
     {
-      fontFile.seek(gBitmap[gNum], fs::SeekSet);
-      pbuffer =  (uint8_t*)malloc(gWidth[gNum]);
+      gPtr = cachedGlyph(gNum);
+      if (!gPtr) {
+        fontFile.seek(gBitmap[gNum], fs::SeekSet);
+        pbuffer =  (uint8_t*)malloc(gWidth[gNum]);
+      }
     }
 #endif
 
@@ -458,65 +986,76 @@ void TFT_eSPI::drawGlyph(uint16_t code)
       }
     }
 
-    for (int32_t y = 0; y < gHeight[gNum]; y++)
+    if (aPtr)
+    {
+      bool swap = _swapBytes;
+      _swapBytes = false; // Atlas images are already byte swapped
+      if (_fillbg) pushImage(cx, cy, gWidth[gNum], gHeight[gNum], (uint16_t*)aPtr);
+      else pushImage(cx, cy, gWidth[gNum], gHeight[gNum], (uint16_t*)aPtr, bg);
+      _swapBytes = swap;
+    }
+    else
     {
+      for (int32_t y = 0; y < gHeight[gNum]; y++)
+      {
 #ifdef FONT_FS_AVAILABLE
-      if (fs_font) {
-        if (spiffs)
-        {
-          fontFile.read(pbuffer, gWidth[gNum]);
-          //Serial.println("SPIFFS");
-        }
-        else
-        {
-          endWrite();    // Release SPI for SD card transaction
-          fontFile.read(pbuffer, gWidth[gNum]);
-          startWrite();  // Re-start SPI for TFT transaction
-          //Serial.println("Not SPIFFS");
+        if (pbuffer) {
+          if (spiffs)
+          {
+            fontFile.read(pbuffer, gWidth[gNum]);
+            //Serial.println("SPIFFS");
+          }
+          else
+          {
+            endWrite();    // Release SPI for SD card transaction
+            fontFile.read(pbuffer, gWidth[gNum]);
+            startWrite();  // Re-start SPI for TFT transaction
+            //Serial.println("Not SPIFFS");
+          }
         }
-      }
 #endif
 
-      for (int32_t x = 0; x < gWidth[gNum]; x++)
-      {
+        for (int32_t x = 0; x < gWidth[gNum]; x++)
+        {
 #ifdef FONT_FS_AVAILABLE
-        if (fs_font) pixel = pbuffer[x];
-        else
+          if (pbuffer) pixel = pbuffer[x];
+          else
 #endif
-        pixel = pgm_read_byte(gPtr + gBitmap[gNum] + x + gWidth[gNum] * y);
+          pixel = pgm_read_byte(gPtr + x + gWidth[gNum] * y);
 
-        if (pixel)
-        {
-          if (bl) { drawFastHLine( bxs, y + cy, bl, bg); bl = 0; }
-          if (pixel != 0xFF)
+          if (pixel)
           {
-            if (fl) {
-              if (fl==1) drawPixel(fxs, y + cy, fg);
-              else drawFastHLine( fxs, y + cy, fl, fg);
-              fl = 0;
+            if (bl) { drawFastHLine( bxs, y + cy, bl, bg); bl = 0; }
+            if (pixel != 0xFF)
+            {
+              if (fl) {
+                if (fl==1) drawPixel(fxs, y + cy, fg);
+                else drawFastHLine( fxs, y + cy, fl, fg);
+                fl = 0;
+              }
+              if (getColor) bg = getColor(x + cx, y + cy);
+              drawPixel(x + cx, y + cy, alphaBlend(pixel, fg, bg));
+            }
+            else
+            {
+              if (fl==0) fxs = x + cx;
+              fl++;
             }
-            if (getColor) bg = getColor(x + cx, y + cy);
-            drawPixel(x + cx, y + cy, alphaBlend(pixel, fg, bg));
           }
           else
           {
-            if (fl==0) fxs = x + cx;
-            fl++;
-          }
-        }
-        else
-        {
-          if (fl) { drawFastHLine( fxs, y + cy, fl, fg); fl = 0; }
-          if (_fillbg) {
-            if (x >= bx) {
-              if (bl==0) bxs = x + cx;
-              bl++;
+            if (fl) { drawFastHLine( fxs, y + cy, fl, fg); fl = 0; }
+            if (_fillbg) {
+              if (x >= bx) {
+                if (bl==0) bxs = x + cx;
+                bl++;
+              }
             }
           }
         }
+        if (fl) { drawFastHLine( fxs, y + cy, fl, fg); fl = 0; }
+        if (bl) { drawFastHLine( bxs, y + cy, bl, bg); bl = 0; }
       }
-      if (fl) { drawFastHLine( fxs, y + cy, fl, fg); fl = 0; }
-      if (bl) { drawFastHLine( bxs, y + cy, bl, bg); bl = 0; }
     }
 
     // Fill area below glyph
@@ -11,6 +11,22 @@
   void     loadFont(String fontName, bool flash = true);
   void     unloadFont( void );
   bool     getUnicodeIndex(uint16_t unicode, uint16_t *index);
+           // RAM in bytes used by the Unicode lookup index built when the font was loaded
+  uint32_t unicodeIndexSize(void);
+
+           // Keep up to "bytes" of recently drawn glyph bitmaps in RAM (PSRAM if available) when
+           // the font is a file, so redrawn text does not read the file system, 0 turns the cache off
+  void     setGlyphCache(uint32_t bytes);
+           // Load the glyphs of a string into the cache ahead of drawing it
+  void     prefetchGlyphs(const char *string);
+           // Cache hits, misses (file reads) and bytes in use, counts are reset by setGlyphCache()
+  void     getGlyphCacheStats(uint32_t *hits, uint32_t *misses, uint32_t *bytesUsed);
+
+           // Keep up to "bytes" of glyphs pre-rendered in the current text colours, so text is
+           // drawn by copying images, the atlas is refilled when the colours change, 0 turns it off
+  void     setGlyphAtlas(uint32_t bytes);
+           // Number of glyphs in the atlas and bytes allocated
+  void     getGlyphAtlasStats(uint32_t *glyphs, uint32_t *bytesUsed);
 
   virtual void drawGlyph(uint16_t code);
 
@@ -55,7 +71,51 @@ fontMetrics gFont = { nullptr, 0, 0, 0, 0, 0, 0, 0 };
   private:
 
   void     loadMetrics(void);
+  void     buildUnicodeIndex(void);
+  void     shareFont(TFT_eSPI *dst, bool share);
   uint32_t readInt32(void);
 
+  // Unicode lookup index, built by loadMetrics() so getUnicodeIndex() need not scan gUnicode
+  uint16_t* gLatin  = NULL;   // glyph number + 1 for codes 0x00-0xFF, 0 if not in font
+  uint16_t* gSorted = NULL;   // glyph numbers of codes > 0xFF in code order, NULL if gUnicode is already sorted
+  uint16_t  gHighFirst = 0;   // first glyph with code > 0xFF when gUnicode is sorted
+  uint16_t  gHighCount = 0;   // number of glyphs with code > 0xFF
+
+  // Glyph bitmap cache for file fonts, entries are in a list from most to least recently used
+  // and are found by glyph number in a small hash table
+  #define GLYPH_CACHE_BUCKETS 32     // Hash table size, a power of 2
+  typedef struct glyphCacheEntry
+  {
+    struct glyphCacheEntry* prev;    // More recently used entry
+    struct glyphCacheEntry* next;    // Less recently used entry
+    struct glyphCacheEntry* hnext;   // Next entry in the same hash bucket
+    uint16_t gNum;                   // Glyph number
+    uint16_t size;                   // Bitmap bytes, these follow the entry
+  } glyphCacheEntry;
+
+  const uint8_t* cachedGlyph(uint16_t gNum);
+  void     evictGlyph(void);
+  void     clearGlyphCache(void);
+
+  glyphCacheEntry** gcBucket = nullptr; // Hash table, allocated when the first glyph is cached
+  glyphCacheEntry* gcHead = nullptr; // Most recently used
+  glyphCacheEntry* gcTail = nullptr; // Least recently used, evicted first
+  uint32_t gcBudget = 0;             // Cache size limit in bytes, 0 = no cache
+  uint32_t gcUsed   = 0;             // Bytes allocated including entry headers
+  uint32_t gcHits   = 0;
+  uint32_t gcMisses = 0;
+
+  // Glyph atlas, RGB565 images of glyphs blended for one foreground/background colour pair
+  const uint16_t* atlasGlyph(uint16_t gNum, uint16_t fg, uint16_t bg, bool *inkIsBg);
+  void     freeGlyphAtlas(void);
+
+  uint16_t* gaPixels = nullptr;      // Byte swapped glyph images packed end to end
+  uint32_t* gaIndex  = nullptr;      // Per glyph offset + 1 into gaPixels, 0 = not in atlas, bit 31 = ink matches bg
+  uint32_t  gaBudget = 0;            // Atlas size limit in bytes including gaIndex, 0 = no atlas
+  uint32_t  gaSize   = 0;            // gaPixels capacity in pixels
+  uint32_t  gaUsed   = 0;            // gaPixels used in pixels
+  uint16_t  gaGlyphs = 0;            // Glyphs in atlas
+  uint16_t  gaFg = 0, gaBg = 0;      // Colours the atlas was rendered with
+
   uint8_t* fontPtr = nullptr;
 
@@ -34,10 +34,19 @@ TFT_eSprite::TFT_eSprite(TFT_eSPI *tft)
   _xptr = 0; // pushColor coordinate
   _yptr = 0;
 
-  _colorMap = nullptr;
+  _colorMap   = nullptr;
+  _colorIndex = nullptr;
+  _paletteSize = 0;
+  _dither     = 0;
+  _alpha      = nullptr;
+
+  _dirtyTrack = false; // No dirty rectangle tracking by default
+  _dirtyCount = 0;
 
   _psram_enable = true;
-  
+
+  _pool = nullptr;
+
   // Ensure end_tft_write() does nothing in inherited functions.
   lockTransaction = true;
 }
@@ -68,14 +77,17 @@ void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames)
   _sh = h;
   _scolor = TFT_BLACK;
 
+  _dirtyCount = 0;
+
   _img8   = (uint8_t*) callocSprite(w, h, frames);
   _img8_1 = _img8;
   _img8_2 = _img8;
   _img    = (uint16_t*) _img8;
   _img4   = _img8;
 
+  // Second frame starts on a 32-bit boundary so frames can be compared a word at a time
   if ( (_bpp == 16) && (frames > 1) ) {
-    _img8_2 = _img8 + (w * h * 2 + 1);
+    _img8_2 = _img8 + ((w * h * 2 + 2 + 3) & ~3);
   }
 
   // ESP32 only 16bpp check
@@ -85,7 +97,7 @@ void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames)
   //else Serial.println("Not a DMA capable Sprite pointer _img8_2");
 
   if ( (_bpp == 8) && (frames > 1) ) {
-    _img8_2 = _img8 + (w * h + 1);
+    _img8_2 = _img8 + ((w * h + 1 + 3) & ~3);
   }
 
   // This is to make it clear what pointer size is expected to be used
@@ -93,7 +105,7 @@ void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames)
   if ( (_bpp == 1) && (frames > 1) )
   {
     w = (w+7) & 0xFFF8;
-    _img8_2 = _img8 + ( (w>>3) * h + 1 );
+    _img8_2 = _img8 + (((w>>3) * h + 1 + 3) & ~3);
   }
 
   if (_img8)
@@ -143,6 +155,9 @@ TFT_eSprite::~TFT_eSprite(void)
 #ifdef SMOOTH_FONT
   if(fontLoaded) unloadFont();
 #endif
+
+  setArcCache(0);
+  setTextLineBuffer(0);
 }
 
 
@@ -155,45 +170,32 @@ void* TFT_eSprite::callocSprite(int16_t w, int16_t h, uint8_t frames)
   // Add one extra "off screen" pixel to point out-of-bounds setWindow() coordinates
   // this means push/writeColor functions do not need additional bounds checks and
   // hence will run faster in normal circumstances.
-  uint8_t* ptr8 = nullptr;
+  uint32_t bytes;
 
   if (frames > 2) frames = 2; // Currently restricted to 2 frame buffers
   if (frames < 1) frames = 1;
 
+  // A second frame starts on a 32-bit boundary, allow for up to 3 padding bytes
+  uint8_t pad = (frames - 1) * 3;
+
+  // PSRAM is not used for 16bpp Sprites if DMA is enabled
+  bool psram = !(_bpp == 16 && _tft->DMA_Enabled);
+
   if (_bpp == 16)
   {
-#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
-    if ( psramFound() && _psram_enable && !_tft->DMA_Enabled)
-    {
-      ptr8 = ( uint8_t*) ps_calloc(frames * w * h + frames, sizeof(uint16_t));
-      //Serial.println("PSRAM");
-    }
-    else
-#endif
-    {
-      ptr8 = ( uint8_t*) calloc(frames * w * h + frames, sizeof(uint16_t));
-      //Serial.println("Normal RAM");
-    }
+    bytes = (frames * w * h + frames + ((pad + 1)>>1)) * sizeof(uint16_t);
   }
 
   else if (_bpp == 8)
   {
-#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
-    if ( psramFound() && _psram_enable ) ptr8 = ( uint8_t*) ps_calloc(frames * w * h + frames, sizeof(uint8_t));
-    else
-#endif
-    ptr8 = ( uint8_t*) calloc(frames * w * h + frames, sizeof(uint8_t));
+    bytes = frames * w * h + frames + pad;
   }
 
   else if (_bpp == 4)
   {
     w = (w+1) & 0xFFFE; // width needs to be multiple of 2, with an extra "off screen" pixel
     _iwidth = w;
-#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
-    if ( psramFound() && _psram_enable ) ptr8 = ( uint8_t*) ps_calloc(((frames * w * h) >> 1) + frames, sizeof(uint8_t));
-    else
-#endif
-    ptr8 = ( uint8_t*) calloc(((frames * w * h) >> 1) + frames, sizeof(uint8_t));
+    bytes = ((frames * w * h) >> 1) + frames;
   }
 
   else // Must be 1 bpp
@@ -206,72 +208,276 @@ void* TFT_eSprite::callocSprite(int16_t w, int16_t h, uint8_t frames)
     _iwidth = w;         // _iwidth is rounded up to be multiple of 8, so might not be = _dwidth
     _bitwidth = w;       // _bitwidth will not be rotated whereas _iwidth may be
 
+    bytes = frames * (w>>3) * h + frames + pad;
+  }
+
+  return spriteAlloc(bytes, psram);
+}
+
+
+/***************************************************************************************
+** Function name:           spriteAlloc
+** Description:             Allocate zeroed memory for the Sprite from the pool or heap
+***************************************************************************************/
+// psram true allows PSRAM to be used if found and enabled
+void* TFT_eSprite::spriteAlloc(uint32_t bytes, bool psram)
+{
+  if (_pool) return _pool->alloc(bytes);
+
 #if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
-    if ( psramFound() && _psram_enable ) ptr8 = ( uint8_t*) ps_calloc(frames * (w>>3) * h + frames, sizeof(uint8_t));
-    else
+  if ( psram && psramFound() && _psram_enable ) return ps_calloc(bytes, 1);
+#else
+  (void)psram;
 #endif
-    ptr8 = ( uint8_t*) calloc(frames * (w>>3) * h + frames, sizeof(uint8_t));
-  }
 
-  return ptr8;
+  return calloc(bytes, 1);
+}
+
+
+/***************************************************************************************
+** Function name:           spriteFree
+** Description:             Free memory from spriteAlloc()
+***************************************************************************************/
+void TFT_eSprite::spriteFree(void *ptr)
+{
+  if (_pool && _pool->owns(ptr)) _pool->free(ptr);
+  else free(ptr);
+}
+
+
+/***************************************************************************************
+** Function name:           setPool
+** Description:             Take Sprite memory from a pool, or the heap if nullptr
+***************************************************************************************/
+bool TFT_eSprite::setPool(TFT_eSPI_SpritePool *pool)
+{
+  if (_created) return false; // Memory must be returned to where it came from
+
+  _pool = pool;
+
+  return true;
 }
 
 
 /***************************************************************************************
 ** Function name:           createPalette (from RAM array)
-** Description:             Set a palette for a 4-bit per pixel sprite
+** Description:             Set a palette for a 4-bit or 8-bit per pixel sprite
 ***************************************************************************************/
-void TFT_eSprite::createPalette(uint16_t colorMap[], uint8_t colors)
+void TFT_eSprite::createPalette(uint16_t colorMap[], uint16_t colors)
 {
   if (!_created) return;
 
   if (colorMap == nullptr)
   {
-    // Create a color map using the default FLASH map
-    createPalette(default_4bit_palette);
+    // Create a color map using the default map
+    createPalette((const uint16_t *)nullptr, colors);
     return;
   }
 
-  // Allocate and clear memory for 16 color map
-  if (_colorMap == nullptr) _colorMap = (uint16_t *)calloc(16, sizeof(uint16_t));
+  uint16_t size = (_bpp == 8) ? 256 : 16;
+  if (colors == 0 || colors > size) colors = size;
+
+  // Allocate and clear memory for the color map
+  if (_colorMap == nullptr) _colorMap = (uint16_t *)spriteAlloc(size * sizeof(uint16_t), false);
 
-  if (colors > 16) colors = 16;
+  if (_bpp == 8)
+  {
+    if (_colorIndex == nullptr) _colorIndex = (uint8_t *)spriteAlloc(4096, false);
+    if (_colorMap == nullptr || _colorIndex == nullptr) { deletePalette(); return; } // Stay RGB332
+  }
 
   // Copy map colors
-  for (uint8_t i = 0; i < colors; i++)
+  for (uint16_t i = 0; i < colors; i++)
   {
     _colorMap[i] = colorMap[i];
   }
+
+  if (_bpp == 8)
+  {
+    _paletteSize = colors;
+    indexPalette();
+  }
 }
 
 
 /***************************************************************************************
 ** Function name:           createPalette (from FLASH array)
-** Description:             Set a palette for a 4-bit per pixel sprite
+** Description:             Set a palette for a 4-bit or 8-bit per pixel sprite
 ***************************************************************************************/
-void TFT_eSprite::createPalette(const uint16_t colorMap[], uint8_t colors)
+void TFT_eSprite::createPalette(const uint16_t colorMap[], uint16_t colors)
 {
   if (!_created) return;
 
-  if (colorMap == nullptr)
+  uint16_t size = (_bpp == 8) ? 256 : 16;
+  if (colors == 0 || colors > size) colors = size;
+
+  // Allocate and clear memory for the color map
+  if (_colorMap == nullptr) _colorMap = (uint16_t *)spriteAlloc(size * sizeof(uint16_t), false);
+
+  if (_bpp == 8)
+  {
+    if (_colorIndex == nullptr) _colorIndex = (uint8_t *)spriteAlloc(4096, false);
+    if (_colorMap == nullptr || _colorIndex == nullptr) { deletePalette(); return; } // Stay RGB332
+  }
+
+  if (colorMap == nullptr && _bpp == 8)
+  {
+    // The default 8-bit palette holds the RGB332 colours
+    for (uint16_t i = 0; i < 256; i++) _colorMap[i] = color8to16(i);
+    colors = 256;
+  }
+  else
   {
     // Create a color map using the default FLASH map
-    colorMap = default_4bit_palette;
+    if (colorMap == nullptr) colorMap = default_4bit_palette;
+
+    // Copy map colors
+    for (uint16_t i = 0; i < colors; i++)
+    {
+      _colorMap[i] = pgm_read_word(colorMap++);
+    }
+  }
+
+  if (_bpp == 8)
+  {
+    _paletteSize = colors;
+    indexPalette();
   }
+}
 
-  // Allocate and clear memory for 16 color map
-  if (_colorMap == nullptr) _colorMap = (uint16_t *)calloc(16, sizeof(uint16_t));
 
-  if (colors > 16) colors = 16;
+/***************************************************************************************
+** Function name:           deletePalette
+** Description:             Free the palette, 8-bit sprites return to RGB332 colours
+***************************************************************************************/
+void TFT_eSprite::deletePalette(void)
+{
+  if (_bpp == 4 && _colorMap) return; // 4-bit Sprites always need a palette
 
-  // Copy map colors
-  for (uint8_t i = 0; i < colors; i++)
+  spriteFree(_colorMap);
+  spriteFree(_colorIndex);
+  _colorMap    = nullptr;
+  _colorIndex  = nullptr;
+  _paletteSize = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           indexPalette
+** Description:             Map each RGB444 colour to the nearest 8-bit palette colour
+***************************************************************************************/
+// Table entries hold the palette colour nearest the centre of their RGB444 box. With index
+// -1 all entries are set, otherwise only entries that now map to, or used to map to, the
+// palette colour at index are updated
+void TFT_eSprite::indexPalette(int16_t index)
+{
+  if (_colorIndex == nullptr) return;
+
+  // Palette colours as 8-bit channels
+  uint8_t pr[_paletteSize], pg[_paletteSize], pb[_paletteSize];
+  for (uint16_t i = 0; i < _paletteSize; i++)
+  {
+    uint16_t c = _colorMap[i];
+    pr[i] = (c >> 8 & 0xF8) | c >> 13;
+    pg[i] = (c >> 3 & 0xFC) | (c >> 9 & 0x03);
+    pb[i] = (c << 3 & 0xF8) | (c >> 2 & 0x07);
+  }
+
+  uint16_t cell = 0;
+  for (int32_t r = 8; r < 256; r += 16)
+  {
+    for (int32_t g = 8; g < 256; g += 16)
+    {
+      for (int32_t b = 8; b < 256; b += 16, cell++)
+      {
+        uint8_t  best  = 0;
+        int32_t  bestDist = 0x7FFFFFFF;
+        uint16_t first = 0, last = _paletteSize;
+
+        // An entry that did not map to index only changes if the new colour is nearer
+        if ((index >= 0) && (_colorIndex[cell] != index))
+        {
+          best  = _colorIndex[cell];
+          int32_t dr = r - pr[best], dg = g - pg[best], db = b - pb[best];
+          bestDist = 2 * dr * dr + 4 * dg * dg + 3 * db * db;
+          first = index;
+          last  = index + 1;
+        }
+
+        for (uint16_t i = first; i < last; i++)
+        {
+          int32_t dr = r - pr[i], dg = g - pg[i], db = b - pb[i];
+          int32_t dist = 2 * dr * dr + 4 * dg * dg + 3 * db * db; // Weighted for the eye
+          if (dist < bestDist) { bestDist = dist; best = i; }
+        }
+
+        _colorIndex[cell] = best;
+      }
+    }
+  }
+
+  // Palette colours map to themselves, unless a later one is in the same table entry
+  for (uint16_t i = 0; i < _paletteSize; i++)
   {
-    _colorMap[i] = pgm_read_word(colorMap++);
+    _colorIndex[(pr[i] & 0xF0) << 4 | (pg[i] & 0xF0) | pb[i] >> 4] = i;
   }
 }
 
 
+/***************************************************************************************
+** Function name:           color8
+** Description:             Convert a 565 colour to an 8-bit Sprite pixel value
+***************************************************************************************/
+uint8_t TFT_eSprite::color8(uint16_t color)
+{
+  if (_colorIndex) return _colorIndex[(color >> 4 & 0xF00) | (color >> 3 & 0xF0) | (color >> 1 & 0x0F)];
+  return (color & 0xE000)>>8 | (color & 0x0700)>>6 | (color & 0x0018)>>3;
+}
+
+
+/***************************************************************************************
+** Function name:           color16
+** Description:             Convert an 8-bit Sprite pixel value to a 565 colour
+***************************************************************************************/
+uint16_t TFT_eSprite::color16(uint8_t value)
+{
+  if (_colorIndex) return _colorMap[value];
+  return color8to16(value);
+}
+
+
+/***************************************************************************************
+** Function name:           ditherColor8
+** Description:             Convert a 565 colour to a dithered palette index for x,y
+***************************************************************************************/
+// The offset is -15/32 to +15/32 of the dither spread, from a 4x4 Bayer matrix
+uint8_t TFT_eSprite::ditherColor8(uint16_t color, int32_t x, int32_t y)
+{
+  static const uint8_t bayer[16] = { 0, 8, 2, 10, 12, 4, 14, 6, 3, 11, 1, 9, 15, 7, 13, 5 };
+
+  int32_t d = ((2 * bayer[(x & 3) | (y & 3) << 2] - 15) * _dither) >> 5;
+  int32_t r = (color >> 8 & 0xF8) + d;
+  int32_t g = (color >> 3 & 0xFC) + d;
+  int32_t b = (color << 3 & 0xF8) + d;
+
+  if (r < 0) r = 0; else if (r > 255) r = 255;
+  if (g < 0) g = 0; else if (g > 255) g = 255;
+  if (b < 0) b = 0; else if (b > 255) b = 255;
+
+  return _colorIndex[(r & 0xF0) << 4 | (g & 0xF0) | b >> 4];
+}
+
+
+/***************************************************************************************
+** Function name:           setDither
+** Description:             Set the ordered dither spread for 8-bit palette images
+***************************************************************************************/
+void TFT_eSprite::setDither(uint8_t spread)
+{
+  _dither = spread;
+}
+
+
 /***************************************************************************************
 ** Function name:           frameBuffer
 ** Description:             For 1 bpp Sprites, select the frame used for graphics
@@ -294,6 +500,17 @@ void* TFT_eSprite::frameBuffer(int8_t f)
 }
 
 
+/***************************************************************************************
+** Function name:           getFramePointer
+** Description:             Returns pointer to the frame used for graphics
+***************************************************************************************/
+void* TFT_eSprite::getFramePointer(void)
+{
+  if (!_created) return nullptr;
+  return _img8;
+}
+
+
 /***************************************************************************************
 ** Function name:           setColorDepth
 ** Description:             Set bits per pixel for colour (1, 8 or 16)
@@ -344,23 +561,30 @@ void TFT_eSprite::setBitmapColor(uint16_t c, uint16_t b)
 
 /***************************************************************************************
 ** Function name:           setPaletteColor
-** Description:             Set the 4bpp palette color at the given index
+** Description:             Set the 4bpp or 8bpp palette color at the given index
 ***************************************************************************************/
 void TFT_eSprite::setPaletteColor(uint8_t index, uint16_t color)
 {
-  if (_colorMap == nullptr || index > 15) return; // out of bounds
+  if (_colorMap == nullptr || (_bpp != 8 && index > 15)) return; // out of bounds
 
   _colorMap[index] = color;
+
+  // An 8-bit palette grows to include index, then nearest colours are updated
+  if (_colorIndex)
+  {
+    if (index >= _paletteSize) _paletteSize = index + 1;
+    indexPalette(index);
+  }
 }
 
 
 /***************************************************************************************
 ** Function name:           getPaletteColor
-** Description:             Return the palette color at 4bpp index, or 0 on error.
+** Description:             Return the palette color at 4bpp or 8bpp index, or 0 on error.
 ***************************************************************************************/
 uint16_t TFT_eSprite::getPaletteColor(uint8_t index)
 {
-  if (_colorMap == nullptr || index > 15) return 0; // out of bounds
+  if (_colorMap == nullptr || (_bpp != 8 && index > 15)) return 0; // out of bounds
 
   return _colorMap[index];
 }
@@ -374,26 +598,186 @@ void TFT_eSprite::deleteSprite(void)
 {
   if (_colorMap != nullptr)
   {
-    free(_colorMap);
+    spriteFree(_colorMap);
     _colorMap = nullptr;
   }
 
+  deletePalette();
+
+  deleteAlpha();
+
   if (_created)
   {
-    free(_img8_1);
+    spriteFree(_img8_1);
     _img8 = nullptr;
     _created = false;
+    _dirtyCount = 0;
     _vpOoB   = true;  // TFT_eSPI class write() uses this to check for valid sprite
   }
 }
 
 
+#define FP_SCALE 10
+
+/***************************************************************************************
+** Function name:           rotatedSpan
+** Description:             Limit k0,k1 to the steps where 0 <= a + k * d < e
+***************************************************************************************/
+// Used to find the part of a destination line that maps inside the source Sprite
+static inline int32_t floorDiv(int32_t n, int32_t d) { return n >= 0 ? n / d : -((d - 1 - n) / d); }
+
+static inline void rotatedSpan(int32_t a, int32_t d, int32_t e, int32_t *k0, int32_t *k1)
+{
+  int32_t lo, hi;
+
+  if (d == 0)
+  {
+    if (a >= 0 && a < e) return;
+    *k0 = 1; *k1 = 0; // Empty span
+    return;
+  }
+
+  if (d > 0) { lo = -floorDiv(a, d);         hi = floorDiv(e - 1 - a, d); }
+  else       { lo = -floorDiv(e - 1 - a, -d); hi = floorDiv(a, -d); }
+
+  if (lo > *k0) *k0 = lo;
+  if (hi < *k1) *k1 = hi;
+}
+
+
+/***************************************************************************************
+** Function name:           rotatedPixel
+** Description:             Return the 565 colour of a source pixel for rotation
+***************************************************************************************/
+uint16_t TFT_eSprite::rotatedPixel(int32_t x, int32_t y)
+{
+  if (_bpp == 16)
+  {
+    uint16_t color = _img[x + y * _iwidth];
+    return color >> 8 | color << 8;
+  }
+  return readPixel(x, y);
+}
+
+
+/***************************************************************************************
+** Function name:           rotatedLine
+** Description:             Fetch n byte swapped source pixels stepping from xs,ys
+***************************************************************************************/
+// xs,ys are fixed point and all n steps must be inside the Sprite
+void TFT_eSprite::rotatedLine(uint16_t *buf, int32_t xs, int32_t ys, int32_t n)
+{
+  if (_bpp == 16)
+  {
+    while (n--)
+    {
+      *buf++ = _img[(xs >> FP_SCALE) + (ys >> FP_SCALE) * _iwidth];
+      xs += _cosra; ys += _sinra;
+    }
+  }
+  else if (_bpp == 8)
+  {
+    uint8_t  blue[] = {0, 11, 21, 31};
+    while (n--)
+    {
+      uint16_t color = _img8[(xs >> FP_SCALE) + (ys >> FP_SCALE) * _iwidth];
+      if (_colorMap) color = _colorMap[color];
+      else color =   (color & 0xE0)<<8 | (color & 0xC0)<<5
+                   | (color & 0x1C)<<6 | (color & 0x1C)<<3
+                   | blue[color & 0x03];
+      *buf++ = color >> 8 | color << 8;
+      xs += _cosra; ys += _sinra;
+    }
+  }
+  else if (_bpp == 4)
+  {
+    uint16_t map[16]; // Byte swapped palette
+    for (uint8_t i = 0; i < 16; i++) map[i] = _colorMap[i] >> 8 | _colorMap[i] << 8;
+    while (n--)
+    {
+      int32_t xy = (xs >> FP_SCALE) + (ys >> FP_SCALE) * _iwidth;
+      if (xy & 0x01) *buf++ = map[_img4[xy >> 1] & 0x0F]; // odd index = bits 3 .. 0.
+      else           *buf++ = map[_img4[xy >> 1] >> 4];   // even index = bits 7 .. 4
+      xs += _cosra; ys += _sinra;
+    }
+  }
+  else if (rotation == 0) // 1bpp
+  {
+    uint16_t fg = _tft->bitmap_fg >> 8 | _tft->bitmap_fg << 8;
+    uint16_t bg = _tft->bitmap_bg >> 8 | _tft->bitmap_bg << 8;
+    while (n--)
+    {
+      int32_t xy = (xs >> FP_SCALE) + (ys >> FP_SCALE) * _bitwidth;
+      *buf++ = (_img8[xy >> 3] & (0x80 >> (xy & 0x7))) ? fg : bg;
+      xs += _cosra; ys += _sinra;
+    }
+  }
+  else // Rotated 1bpp coordinates
+  {
+    while (n--)
+    {
+      uint16_t color = readPixel(xs >> FP_SCALE, ys >> FP_SCALE);
+      *buf++ = color >> 8 | color << 8;
+      xs += _cosra; ys += _sinra;
+    }
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           rotatedBilinear
+** Description:             Return bilinear filtered source colour at fixed point xs,ys
+***************************************************************************************/
+// Source pixels of the transparent colour are replaced by colour bg so the key colour does
+// not bleed into edges. Result is a 565 colour, not byte swapped.
+uint16_t TFT_eSprite::rotatedBilinear(int32_t xs, int32_t ys, uint32_t transp, uint16_t bg)
+{
+  // Pixel centres are at +0.5, remove that offset then split integer and fraction
+  int32_t u = xs - (1 << (FP_SCALE - 1));
+  int32_t v = ys - (1 << (FP_SCALE - 1));
+  int32_t x0 = u >> FP_SCALE;
+  int32_t y0 = v >> FP_SCALE;
+  uint8_t fx = (u & ((1 << FP_SCALE) - 1)) >> (FP_SCALE - 8);
+  uint8_t fy = (v & ((1 << FP_SCALE) - 1)) >> (FP_SCALE - 8);
+
+  // Clamp the 2x2 neighbourhood to the Sprite edges
+  int32_t x1 = x0 + 1;
+  int32_t y1 = y0 + 1;
+  if (x0 < 0) x0 = 0;
+  if (y0 < 0) y0 = 0;
+  if (x1 >= _dwidth)  x1 = _dwidth  - 1;
+  if (y1 >= _dheight) y1 = _dheight - 1;
+
+  uint16_t c00 = rotatedPixel(x0, y0);
+  uint16_t c10 = rotatedPixel(x1, y0);
+  uint16_t c01 = rotatedPixel(x0, y1);
+  uint16_t c11 = rotatedPixel(x1, y1);
+
+  if (transp != 0x00FFFFFF)
+  {
+    uint16_t tp = (_bpp == 4) ? _colorMap[transp & 0x0F] : (uint16_t)transp;
+    if (_bpp == 8 && _colorMap) tp = _colorMap[color8(transp)];
+    if (c00 == tp) c00 = bg;
+    if (c10 == tp) c10 = bg;
+    if (c01 == tp) c01 = bg;
+    if (c11 == tp) c11 = bg;
+  }
+
+  uint16_t top = fastBlend(fx, c10, c00);
+  uint16_t bot = fastBlend(fx, c11, c01);
+
+  return fastBlend(fy, bot, top);
+}
+
+
 /***************************************************************************************
 ** Function name:           pushRotated - Fast fixed point integer maths version
 ** Description:             Push rotated Sprite to TFT screen
 ***************************************************************************************/
-#define FP_SCALE 10
-bool TFT_eSprite::pushRotated(int16_t angle, uint32_t transp)
+// The part of each destination line that maps inside the Sprite is calculated directly,
+// then the pixels are fetched by a loop specific to the colour depth. With smooth true the
+// 4 nearest source pixels are bilinear filtered instead.
+bool TFT_eSprite::pushRotated(int16_t angle, uint32_t transp, bool smooth)
 {
   if ( !_created || _tft->_vpOoB) return false;
 
@@ -406,57 +790,71 @@ bool TFT_eSprite::pushRotated(int16_t angle, uint32_t transp)
   // Get the bounding box of this rotated source Sprite relative to Sprite pivot
   if ( !getRotatedBounds(angle, &min_x, &min_y, &max_x, &max_y) ) return false;
 
-  uint16_t sline_buffer[max_x - min_x + 1];
+  int32_t n = max_x - min_x; // Pixels scanned per line
+  if (n < 1) return true;
+
+  uint16_t sline_buffer[n];
 
   int32_t xt = min_x - _tft->_xPivot;
   int32_t yt = min_y - _tft->_yPivot;
-  uint32_t xe = _dwidth << FP_SCALE;
-  uint32_t ye = _dheight << FP_SCALE;
+  int32_t xe = _dwidth << FP_SCALE;
+  int32_t ye = _dheight << FP_SCALE;
   uint16_t tpcolor = (uint16_t)transp;
 
   if (transp != 0x00FFFFFF) {
     if (_bpp == 4) tpcolor = _colorMap[transp & 0x0F];
+    else if (_bpp == 8 && _colorMap) tpcolor = _colorMap[color8(transp)];
     tpcolor = tpcolor>>8 | tpcolor<<8; // Working with swapped color bytes
   }
+
+  bool oldSwapBytes = _tft->getSwapBytes();
+  _tft->setSwapBytes(false);
+
   _tft->startWrite(); // Avoid transaction overhead for every tft pixel
 
   // Scan destination bounding box and fetch transformed pixels from source Sprite
-  for (int32_t y = min_y; y <= max_y; y++, yt++) {
-    int32_t x = min_x;
-    uint32_t xs = (_cosra * xt - (_sinra * yt - (_xPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
-    uint32_t ys = (_sinra * xt + (_cosra * yt + (_yPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+  for (int32_t y = min_y; y < max_y; y++, yt++) {
+    int32_t xs = (_cosra * xt - (_sinra * yt - (_xPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+    int32_t ys = (_sinra * xt + (_cosra * yt + (_yPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
 
-    while ((xs >= xe || ys >= ye) && x < max_x) { x++; xs += _cosra; ys += _sinra; }
-    if (x == max_x) continue;
+    // Find the steps k0 to k1 along this line that are inside the source Sprite
+    int32_t k0 = 0, k1 = n - 1;
+    rotatedSpan(xs, _cosra, xe, &k0, &k1);
+    rotatedSpan(ys, _sinra, ye, &k0, &k1);
+    if (k0 > k1) continue;
 
-    uint32_t pixel_count = 0;
-    do {
-      uint32_t rp;
-      int32_t xp = xs >> FP_SCALE;
-      int32_t yp = ys >> FP_SCALE;
-      if (_bpp == 16) {rp = _img[xp + yp * _iwidth]; }
-      else { rp = readPixel(xp, yp); rp = (uint16_t)(rp>>8 | rp<<8); }
-      if (transp != 0x00FFFFFF && tpcolor == rp) {
-        if (pixel_count) {
-          // TFT window is already clipped, so this is faster than pushImage()
-          _tft->setWindow(x - pixel_count, y, x - 1, y);
-          _tft->pushPixels(sline_buffer, pixel_count);
-          pixel_count = 0;
-        }
-      }
-      else {
-        sline_buffer[pixel_count++] = rp;
-      }
-    } while (++x < max_x && (xs += _cosra) < xe && (ys += _sinra) < ye);
-    if (pixel_count) {
+    int32_t x = min_x + k0;
+    int32_t count = k1 - k0 + 1;
+    xs += k0 * _cosra;
+    ys += k0 * _sinra;
+
+    if (smooth) rotatedSmooth(sline_buffer, xs, ys, count, transp, tpcolor, nullptr, x, y);
+    else        rotatedLine(sline_buffer, xs, ys, count);
+
+    if (transp == 0x00FFFFFF) {
       // TFT window is already clipped, so this is faster than pushImage()
-      _tft->setWindow(x - pixel_count, y, x - 1, y);
-      _tft->pushPixels(sline_buffer, pixel_count);
+      _tft->setWindow(x, y, x + count - 1, y);
+      _tft->pushPixels(sline_buffer, count);
+      continue;
+    }
+
+    // Push runs of pixels that are not transparent
+    int32_t i = 0;
+    while (i < count) {
+      while (i < count && sline_buffer[i] == tpcolor) i++;
+      int32_t s = i;
+      while (i < count && sline_buffer[i] != tpcolor) i++;
+      if (i > s) {
+        _tft->setWindow(x + s, y, x + i - 1, y);
+        _tft->pushPixels(sline_buffer + s, i - s);
+      }
     }
   }
 
   _tft->endWrite(); // End transaction
 
+  _tft->setSwapBytes(oldSwapBytes);
+
   return true;
 }
 
@@ -465,11 +863,16 @@ bool TFT_eSprite::pushRotated(int16_t angle, uint32_t transp)
 ** Function name:           pushRotated - Fast fixed point integer maths version
 ** Description:             Push a rotated copy of the Sprite to another Sprite
 ***************************************************************************************/
-// Not compatible with 4bpp
-bool TFT_eSprite::pushRotated(TFT_eSprite *spr, int16_t angle, uint32_t transp)
+// 4bpp and 1bpp destinations hold colour indexes so need a source of the same colour
+// depth and smooth is ignored. Otherwise any source colour depth can be used and with
+// smooth true the destination pixels show through transparent source pixels at edges.
+bool TFT_eSprite::pushRotated(TFT_eSprite *spr, int16_t angle, uint32_t transp, bool smooth)
 {
-  if ( !_created  || _bpp == 4) return false; // Check this Sprite is created
-  if ( !spr->_created  || spr->_bpp == 4) return false;  // Ckeck destination Sprite is created
+  if ( !_created ) return false; // Check this Sprite is created
+  if ( !spr->_created ) return false;  // Ckeck destination Sprite is created
+
+  bool index = (spr->_bpp == 4) || (spr->_bpp == 1);
+  if (index && (spr->_bpp != _bpp)) return false;
 
   // Bounding box parameters
   int16_t min_x;
@@ -480,16 +883,20 @@ bool TFT_eSprite::pushRotated(TFT_eSprite *spr, int16_t angle, uint32_t transp)
   // Get the bounding box of this rotated source Sprite
   if ( !getRotatedBounds(spr, angle, &min_x, &min_y, &max_x, &max_y) ) return false;
 
-  uint16_t sline_buffer[max_x - min_x + 1];
+  int32_t n = max_x - min_x; // Pixels scanned per line
+  if (n < 1) return true;
+
+  uint16_t sline_buffer[n];
 
   int32_t xt = min_x - spr->_xPivot;
   int32_t yt = min_y - spr->_yPivot;
-  uint32_t xe = _dwidth << FP_SCALE;
-  uint32_t ye = _dheight << FP_SCALE;
+  int32_t xe = _dwidth << FP_SCALE;
+  int32_t ye = _dheight << FP_SCALE;
   uint16_t tpcolor = (uint16_t)transp;
   
   if (transp != 0x00FFFFFF) {
     if (_bpp == 4) tpcolor = _colorMap[transp & 0x0F];
+    else if (_bpp == 8 && _colorMap) tpcolor = _colorMap[color8(transp)];
     tpcolor = tpcolor>>8 | tpcolor<<8; // Working with swapped color bytes
   }
 
@@ -497,38 +904,98 @@ bool TFT_eSprite::pushRotated(TFT_eSprite *spr, int16_t angle, uint32_t transp)
   spr->setSwapBytes(false);
 
   // Scan destination bounding box and fetch transformed pixels from source Sprite
-  for (int32_t y = min_y; y <= max_y; y++, yt++) {
-    int32_t x = min_x;
-    uint32_t xs = (_cosra * xt - (_sinra * yt - (_xPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
-    uint32_t ys = (_sinra * xt + (_cosra * yt + (_yPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
-
-    while ((xs >= xe || ys >= ye) && x < max_x) { x++; xs += _cosra; ys += _sinra; }
-    if (x == max_x) continue;
-
-    uint32_t pixel_count = 0;
-    do {
-      uint32_t rp;
-      int32_t xp = xs >> FP_SCALE;
-      int32_t yp = ys >> FP_SCALE;
-      if (_bpp == 16) rp = _img[xp + yp * _iwidth];
-      else { rp = readPixel(xp, yp); rp = (uint16_t)(rp>>8 | rp<<8); }
-      if (transp != 0x00FFFFFF && tpcolor == rp) {
-        if (pixel_count) {
-          spr->pushImage(x - pixel_count, y, pixel_count, 1, sline_buffer);
-          pixel_count = 0;
+  for (int32_t y = min_y; y < max_y; y++, yt++) {
+    int32_t xs = (_cosra * xt - (_sinra * yt - (_xPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+    int32_t ys = (_sinra * xt + (_cosra * yt + (_yPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+
+    // Find the steps k0 to k1 along this line that are inside the source Sprite
+    int32_t k0 = 0, k1 = n - 1;
+    rotatedSpan(xs, _cosra, xe, &k0, &k1);
+    rotatedSpan(ys, _sinra, ye, &k0, &k1);
+    if (k0 > k1) continue;
+
+    int32_t x = min_x + k0;
+    int32_t count = k1 - k0 + 1;
+    xs += k0 * _cosra;
+    ys += k0 * _sinra;
+
+    if (index)
+    {
+      // Copy colour indexes, the transparent index is skipped
+      for (int32_t i = 0; i < count; i++, xs += _cosra, ys += _sinra)
+      {
+        int32_t xp = xs >> FP_SCALE;
+        int32_t yp = ys >> FP_SCALE;
+        uint16_t rp;
+        if (_bpp == 4) {
+          rp = readPixelValue(xp, yp);
+          if (transp != 0x00FFFFFF && rp == (transp & 0x0F)) continue;
         }
+        else {
+          rp = readPixel(xp, yp);
+          if (transp != 0x00FFFFFF && rp == (uint16_t)transp) continue;
+          rp = (rp == _tft->bitmap_fg);
+        }
+        spr->drawPixel(x + i, y, rp);
       }
-      else {
-        sline_buffer[pixel_count++] = rp;
-      }
-    } while (++x < max_x && (xs += _cosra) < xe && (ys += _sinra) < ye);
-    if (pixel_count) spr->pushImage(x - pixel_count, y, pixel_count, 1, sline_buffer);
+      continue;
+    }
+
+    if (smooth) rotatedSmooth(sline_buffer, xs, ys, count, transp, tpcolor, spr, x, y);
+    else        rotatedLine(sline_buffer, xs, ys, count);
+
+    if (transp == 0x00FFFFFF) {
+      spr->pushImage(x, y, count, 1, sline_buffer);
+      continue;
+    }
+
+    // Push runs of pixels that are not transparent
+    int32_t i = 0;
+    while (i < count) {
+      while (i < count && sline_buffer[i] == tpcolor) i++;
+      int32_t s = i;
+      while (i < count && sline_buffer[i] != tpcolor) i++;
+      if (i > s) spr->pushImage(x + s, y, i - s, 1, sline_buffer + s);
+    }
   }
   spr->setSwapBytes(oldSwapBytes);
   return true;
 }
 
 
+/***************************************************************************************
+** Function name:           rotatedSmooth
+** Description:             Fetch n bilinear filtered byte swapped pixels from xs,ys
+***************************************************************************************/
+// Pixels where the nearest source pixel is transparent are set to tpcolor (swapped),
+// otherwise transparent neighbours are replaced by the destination Sprite pixel, or
+// the nearest source pixel if pushing to the TFT (dspr = nullptr). x,y is the
+// destination coordinate of the first pixel.
+void TFT_eSprite::rotatedSmooth(uint16_t *buf, int32_t xs, int32_t ys, int32_t n, uint32_t transp,
+                                uint16_t tpcolor, TFT_eSprite *dspr, int32_t x, int32_t y)
+{
+  for (int32_t i = 0; i < n; i++, xs += _cosra, ys += _sinra)
+  {
+    uint16_t np = rotatedPixel(xs >> FP_SCALE, ys >> FP_SCALE);
+    uint16_t bg = np;
+
+    if (transp != 0x00FFFFFF)
+    {
+      if (np == (uint16_t)(tpcolor >> 8 | tpcolor << 8)) { buf[i] = tpcolor; continue; }
+      if (dspr) bg = dspr->readPixel(x + i, y);
+    }
+
+    uint16_t color = rotatedBilinear(xs, ys, transp, bg);
+    color = color >> 8 | color << 8;
+
+    // Filtered colour must not be mistaken for the transparent colour, change blue lsb
+    if (transp != 0x00FFFFFF && color == tpcolor) color ^= 0x0100;
+
+    buf[i] = color;
+  }
+}
+
+
 /***************************************************************************************
 ** Function name:           getRotatedBounds
 ** Description:             Get TFT bounding box of a rotated Sprite wrt pivot
@@ -589,8 +1056,8 @@ bool TFT_eSprite::getRotatedBounds(TFT_eSprite *spr, int16_t angle, int16_t *min
 
   // Clip bounding box to Sprite boundaries
   // Clipping to a viewport will be done by destination Sprite pushImage function
-  if (*min_x < 0) min_x = 0;
-  if (*min_y < 0) min_y = 0;
+  if (*min_x < 0) *min_x = 0;
+  if (*min_y < 0) *min_y = 0;
   if (*max_x > spr->width())  *max_x = spr->width();
   if (*max_y > spr->height()) *max_y = spr->height();
 
@@ -671,9 +1138,13 @@ void TFT_eSprite::pushSprite(int32_t x, int32_t y)
   {
     _tft->pushImage(x, y, _dwidth, _dheight, _img4, false, _colorMap);
   }
-  else _tft->pushImage(x, y, _dwidth, _dheight, _img8, (bool)(_bpp == 8));
-}
-
+  else if (_bpp == 8)
+  {
+    _tft->pushImage(x, y, _dwidth, _dheight, _img8, true, _colorMap);
+  }
+  else _tft->pushImage(x, y, _dwidth, _dheight, _img8, false);
+}
+
 
 /***************************************************************************************
 ** Function name:           pushSprite
@@ -692,8 +1163,8 @@ void TFT_eSprite::pushSprite(int32_t x, int32_t y, uint16_t transp)
   }
   else if (_bpp == 8)
   {
-    transp = (uint8_t)((transp & 0xE000)>>8 | (transp & 0x0700)>>6 | (transp & 0x0018)>>3);
-    _tft->pushImage(x, y, _dwidth, _dheight, _img8, (uint8_t)transp, (bool)true);
+    transp = color8(transp);
+    _tft->pushImage(x, y, _dwidth, _dheight, _img8, (uint8_t)transp, (bool)true, _colorMap);
   }
   else if (_bpp == 4)
   {
@@ -703,6 +1174,48 @@ void TFT_eSprite::pushSprite(int32_t x, int32_t y, uint16_t transp)
 }
 
 
+/***************************************************************************************
+** Function name:           pushSpriteDMA
+** Description:             Send the sprite to the TFT at x, y with DMA, then flip frames
+***************************************************************************************/
+// 16bpp pixels are stored byte swapped so the frame is sent as it is, with no CPU copy or
+// conversion, and the call returns while it is being sent. As for pushImageDMA(),
+// tft.startWrite() must be called first. For a Sprite created with 2 frames the graphics
+// functions then draw to the other frame, once any earlier transfer of it has ended, so
+// the next frame is drawn while this one is sent. The new frame holds the image from two
+// pushes ago, so each frame should be fully redrawn. With 1 frame the Sprite must not be
+// changed until the transfer has ended (see dmaFence()). Returns false if DMA is not used,
+// then the sprite is sent with pushSprite() and the frames are still flipped
+bool TFT_eSprite::pushSpriteDMA(int32_t x, int32_t y)
+{
+  if (!_created) return false;
+
+  bool dma = false;
+
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+  dma = (_bpp == 16) && _tft->DMA_Enabled;
+  if (dma)
+  {
+    bool oldSwapBytes = _tft->getSwapBytes();
+    pushArea(x, y, 0, 0, _dwidth, _dheight, true); // Clipped rows are sent in place
+    _tft->setSwapBytes(oldSwapBytes);
+  }
+#endif
+
+  if (!dma) pushSprite(x, y);
+
+  if (_img8_2 != _img8_1)
+  {
+    frameBuffer((_img8 == _img8_1) ? 2 : 1);
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+    if (dma) _tft->dmaFence(_img8, _dwidth * _dheight * 2); // Previous frame may still be being sent
+#endif
+  }
+
+  return dma;
+}
+
+
 /***************************************************************************************
 ** Function name:           pushToSprite
 ** Description:             Push the sprite to another sprite at x, y
@@ -714,12 +1227,15 @@ void TFT_eSprite::pushSprite(int32_t x, int32_t y, uint16_t transp)
 //     8bpp  ->  8bpp
 //     4bpp  ->  4bpp (note: color translation depends on the 2 sprites palette colors)
 //     1bpp  ->  1bpp (note: color translation depends on the 2 sprites bitmap colors)
+// A 16bpp Sprite with an alpha plane is blended into 16bpp and 8bpp destinations
 
 bool TFT_eSprite::pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y)
 {
   if (!_created) return false;
   if (!dspr->created()) return false;
 
+  if (_alpha) return blendToSprite(dspr, x, y);
+
   // Check destination sprite compatibility
   int8_t ds_bpp = dspr->getColorDepth();
   if (_bpp == 16 && ds_bpp != 16 && ds_bpp !=  8) return false;
@@ -729,7 +1245,28 @@ bool TFT_eSprite::pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y)
 
   bool oldSwapBytes = dspr->getSwapBytes();
   dspr->setSwapBytes(false);
-  dspr->pushImage(x, y, _dwidth, _dheight, _img, _bpp);
+
+  // 8bpp pixel values are copied unless the Sprites have different palettes, only the
+  // entries in use are compared as a palette may be smaller than 256 colours
+  bool samePalette = (_colorMap == nullptr && dspr->_colorMap == nullptr);
+  if (_bpp == 8 && dspr->_bpp == 8 && _colorMap && dspr->_colorMap && _paletteSize == dspr->_paletteSize)
+    samePalette = !memcmp(_colorMap, dspr->_colorMap, _paletteSize * sizeof(uint16_t));
+
+  if (_bpp == 8 && !samePalette)
+  {
+    uint16_t lineBuf[_dwidth];
+    for (int32_t yp = 0; yp < _dheight; yp++)
+    {
+      for (int32_t xp = 0; xp < _dwidth; xp++)
+      {
+        uint16_t color = color16(_img8[xp + yp * _iwidth]);
+        lineBuf[xp] = color >> 8 | color << 8; // Byte swapped as for a 16bpp Sprite
+      }
+      dspr->pushImage(x, y + yp, _dwidth, 1, lineBuf);
+    }
+  }
+  else dspr->pushImage(x, y, _dwidth, _dheight, _img, _bpp);
+
   dspr->setSwapBytes(oldSwapBytes);
 
   return true;
@@ -789,104 +1326,872 @@ bool TFT_eSprite::pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y, uint16_t
     if (pixel_count) dspr->pushImage(ox, y, pixel_count, 1, sline_buffer);
     y++;
   }
-  dspr->setSwapBytes(oldSwapBytes);
-  return true;
+  dspr->setSwapBytes(oldSwapBytes);
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           createAlpha
+** Description:             Create an 8-bit alpha plane for a 16bpp Sprite
+***************************************************************************************/
+// Every pixel is given the opacity alpha, 0 = transparent to 255 = opaque. The graphics
+// functions do not change the plane, use fillAlpha() or setAlphaMask() or write to it
+// via getAlphaPointer(). Returns nullptr if not 16bpp or there is not enough memory.
+uint8_t* TFT_eSprite::createAlpha(uint8_t alpha)
+{
+  if ( !_created || _bpp != 16 ) return nullptr;
+
+  if (_alpha == nullptr) _alpha = (uint8_t*) spriteAlloc(_iwidth * _iheight, true);
+
+  if (_alpha) memset(_alpha, alpha, _iwidth * _iheight);
+
+  return _alpha;
+}
+
+
+/***************************************************************************************
+** Function name:           deleteAlpha
+** Description:             Free the alpha plane memory
+***************************************************************************************/
+void TFT_eSprite::deleteAlpha(void)
+{
+  spriteFree(_alpha);
+  _alpha = nullptr;
+}
+
+
+/***************************************************************************************
+** Function name:           getAlphaPointer
+** Description:             Returns pointer to the alpha plane or nullptr
+***************************************************************************************/
+// One byte per pixel, Sprite width bytes per line
+uint8_t* TFT_eSprite::getAlphaPointer(void)
+{
+  return _alpha;
+}
+
+
+/***************************************************************************************
+** Function name:           fillAlpha
+** Description:             Set the alpha values of a rectangle
+***************************************************************************************/
+void TFT_eSprite::fillAlpha(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t alpha)
+{
+  if (_alpha == nullptr || _vpOoB) return;
+
+  x+= _xDatum;
+  y+= _yDatum;
+
+  // Clipping
+  if ((x >= _vpW) || (y >= _vpH)) return;
+
+  if (x < _vpX) { w += x - _vpX; x = _vpX; }
+  if (y < _vpY) { h += y - _vpY; y = _vpY; }
+
+  if ((x + w) > _vpW) w = _vpW - x;
+  if ((y + h) > _vpH) h = _vpH - y;
+
+  if ((w < 1) || (h < 1)) return;
+
+  uint8_t *ptr = _alpha + x + y * _iwidth;
+  while (h--)
+  {
+    memset(ptr, alpha, w);
+    ptr += _iwidth;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           setAlphaMask
+** Description:             Copy a w x h 8-bit alpha mask into the alpha plane at x,y
+***************************************************************************************/
+// Typically the mask is the anti-aliased coverage of an icon drawn in the colour plane
+void TFT_eSprite::setAlphaMask(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *mask)
+{
+  if (_alpha == nullptr || mask == nullptr) return;
+
+  PI_CLIP;
+
+  for (int32_t yp = dy; yp < dy + dh; yp++)
+  {
+    uint8_t *ptr = _alpha + x + y++ * _iwidth;
+    const uint8_t *src = mask + dx + yp * w;
+    for (int32_t xp = 0; xp < dw; xp++) *ptr++ = pgm_read_byte(src++);
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           readAlpha
+** Description:             Return the alpha value of a pixel
+***************************************************************************************/
+// Returns 255 (opaque) if there is no alpha plane and 0 if x,y is outside the Sprite
+uint8_t TFT_eSprite::readAlpha(int32_t x, int32_t y)
+{
+  if (_vpOoB) return 0;
+
+  x+= _xDatum;
+  y+= _yDatum;
+
+  if ((x < _vpX) || (y < _vpY) ||(x >= _vpW) || (y >= _vpH)) return 0;
+
+  if (_alpha == nullptr) return 255;
+
+  return _alpha[x + y * _iwidth];
+}
+
+
+/***************************************************************************************
+** Function name:           alphaSpan
+** Description:             Blend a line of n source pixels onto destination pixels
+***************************************************************************************/
+// Both lines hold byte swapped 565 colours. Runs of alpha 0 are skipped and runs of
+// alpha 255 copied, other pixels are blended with the fastBlend() split multiply.
+static void alphaSpan(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, int32_t n)
+{
+  int32_t i = 0;
+
+  while (i < n)
+  {
+    uint8_t a = alpha[i];
+
+    if (a == 0)
+    {
+      while (++i < n && alpha[i] == 0);
+    }
+    else if (a == 255)
+    {
+      int32_t s = i;
+      while (++i < n && alpha[i] == 255);
+      memcpy(dst + s, src + s, (i - s) << 1);
+    }
+    else
+    {
+      uint16_t fg = src[i] >> 8 | src[i] << 8;
+      uint16_t bg = dst[i] >> 8 | dst[i] << 8;
+      uint16_t color = fastBlend(a, fg, bg);
+      dst[i++] = color >> 8 | color << 8;
+    }
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           pushBlended
+** Description:             Push a Sprite with an alpha plane to the TFT at x, y
+***************************************************************************************/
+// Pixels with alpha 0 are not rendered, partially transparent pixels are blended with
+// colour bg, which should be the colour of the screen area behind the Sprite
+bool TFT_eSprite::pushBlended(int32_t x, int32_t y, uint16_t bg)
+{
+  if ( !_created || _alpha == nullptr ) return false;
+
+  int32_t xd = x;
+  int32_t yd = y;
+  int32_t dw = _dwidth;
+  int32_t dh = _dheight;
+
+  if ( !_tft->clipAddrWindow(&xd, &yd, &dw, &dh) ) return true;
+
+  // Offset of the first visible pixel in the Sprite
+  int32_t dx = xd - x - _tft->_xDatum;
+  int32_t dy = yd - y - _tft->_yDatum;
+
+  uint16_t lineBuf[dw];
+  uint16_t bgs = bg >> 8 | bg << 8;
+
+  bool oldSwapBytes = _tft->getSwapBytes();
+  _tft->setSwapBytes(false);
+
+  _tft->startWrite();
+
+  for (int32_t yp = 0; yp < dh; yp++)
+  {
+    const uint16_t *src = _img + dx + (dy + yp) * _iwidth;
+    const uint8_t  *alpha = _alpha + dx + (dy + yp) * _iwidth;
+
+    // Blend onto a line of background colour, then push runs that are not transparent
+    for (int32_t i = 0; i < dw; i++) lineBuf[i] = bgs;
+    alphaSpan(lineBuf, src, alpha, dw);
+
+    int32_t i = 0;
+    while (i < dw) {
+      while (i < dw && alpha[i] == 0) i++;
+      int32_t s = i;
+      while (i < dw && alpha[i] != 0) i++;
+      if (i > s) {
+        _tft->setWindow(xd + s, yd + yp, xd + i - 1, yd + yp);
+        _tft->pushPixels(lineBuf + s, i - s);
+      }
+    }
+  }
+
+  _tft->endWrite();
+
+  _tft->setSwapBytes(oldSwapBytes);
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           blendToSprite
+** Description:             Blend this Sprite using its alpha plane into Sprite dspr
+***************************************************************************************/
+// 16bpp destinations use the span kernel, 8bpp destinations are blended per pixel
+bool TFT_eSprite::blendToSprite(TFT_eSprite *dspr, int32_t x, int32_t y)
+{
+  if (dspr->_bpp == 8)
+  {
+    for (int32_t yp = 0; yp < _dheight; yp++)
+    {
+      for (int32_t xp = 0; xp < _dwidth; xp++)
+      {
+        uint8_t a = _alpha[xp + yp * _iwidth];
+        if (a == 0) continue;
+        uint16_t color = _img[xp + yp * _iwidth];
+        color = color >> 8 | color << 8;
+        if (a != 255) color = fastBlend(a, color, dspr->readPixel(x + xp, y + yp));
+        dspr->drawPixel(x + xp, y + yp, color);
+      }
+    }
+    return true;
+  }
+
+  if (dspr->_bpp != 16) return false;
+
+  if (dspr->_vpOoB) return true;
+
+  x+= dspr->_xDatum;
+  y+= dspr->_yDatum;
+
+  if ((x >= dspr->_vpW) || (y >= dspr->_vpH)) return true;
+
+  int32_t dx = 0;
+  int32_t dy = 0;
+  int32_t dw = _dwidth;
+  int32_t dh = _dheight;
+
+  if (x < dspr->_vpX) { dx = dspr->_vpX - x; dw -= dx; x = dspr->_vpX; }
+  if (y < dspr->_vpY) { dy = dspr->_vpY - y; dh -= dy; y = dspr->_vpY; }
+
+  if ((x + dw) > dspr->_vpW ) dw = dspr->_vpW - x;
+  if ((y + dh) > dspr->_vpH ) dh = dspr->_vpH - y;
+
+  if (dw < 1 || dh < 1) return true;
+
+  if (dspr->_dirtyTrack) dspr->dirtyArea(x, y, x + dw - 1, y + dh - 1);
+
+  for (int32_t yp = 0; yp < dh; yp++)
+  {
+    int32_t sxy = dx + (dy + yp) * _iwidth;
+    alphaSpan(dspr->_img + x + (y + yp) * dspr->_iwidth, _img + sxy, _alpha + sxy, dw);
+  }
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           pushSprite
+** Description:             Push a cropped sprite to the TFT at tx, ty
+***************************************************************************************/
+bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh)
+{
+  if (!_created) return false;
+
+  // Perform window boundary checks and crop if needed, the area is only read so is not dirty
+  bool track = _dirtyTrack;
+  _dirtyTrack = false;
+  setWindow(sx, sy, sx + sw - 1, sy + sh - 1);
+  _dirtyTrack = track;
+
+  /* These global variables are now populated for the sprite
+  _xs = x start coordinate
+  _ys = y start coordinate
+  _xe = x end coordinate (inclusive)
+  _ye = y end coordinate (inclusive)
+  */
+
+  // Calculate new sprite window bounding box width and height
+  sw = _xe - _xs + 1;
+  sh = _ye - _ys + 1;
+
+  if (_ys >= _iheight) return false;
+
+  if (_bpp == 16)
+  {
+    bool oldSwapBytes = _tft->getSwapBytes();
+    _tft->setSwapBytes(false);
+
+    // Check if a faster block copy to screen is possible
+    if ( sx == 0 && sw == _dwidth)
+      _tft->pushImage(tx, ty, sw, sh, _img + _iwidth * _ys );
+    else // Render line by line
+      while (sh--)
+        _tft->pushImage(tx, ty++, sw, 1, _img + _xs + _iwidth * _ys++ );
+
+    _tft->setSwapBytes(oldSwapBytes);
+  }
+  else if (_bpp == 8)
+  {
+    // Check if a faster block copy to screen is possible
+    if ( sx == 0 && sw == _dwidth)
+      _tft->pushImage(tx, ty, sw, sh, _img8 + _iwidth * _ys, (bool)true, _colorMap );
+    else // Render line by line
+    while (sh--)
+      _tft->pushImage(tx, ty++, sw, 1, _img8 + _xs + _iwidth * _ys++, (bool)true, _colorMap );
+  }
+  else if (_bpp == 4)
+  {
+    // Check if a faster block copy to screen is possible
+    if ( sx == 0 && sw == _dwidth)
+      _tft->pushImage(tx, ty, sw, sh, _img4 + (_iwidth>>1) * _ys, false, _colorMap );
+    else // Render line by line
+    {
+      int32_t ds = _xs&1; // Odd x start pixel
+
+      int32_t de = 0;     // Odd x end pixel
+      if ((sw > ds) && (_xe&1)) de = 1;
+
+      uint32_t dm = 0;     // Midsection pixel count
+      if (sw > (ds+de)) dm = sw - ds - de;
+      sw--;
+
+      uint32_t yp = (_xs + ds + _iwidth * _ys)>>1;
+      _tft->startWrite();
+      while (sh--)
+      {
+        if (ds) _tft->drawPixel(tx, ty, readPixel(_xs, _ys) );
+        if (dm) _tft->pushImage(tx + ds, ty, dm, 1, _img4 + yp, false, _colorMap );
+        if (de) _tft->drawPixel(tx + sw, ty, readPixel(_xe, _ys) );
+        _ys++;
+        ty++;
+        yp += (_iwidth>>1);
+      }
+      _tft->endWrite();
+    }
+  }
+  else // 1bpp
+  {
+    // Check if a faster block copy to screen is possible
+    if ( sx == 0 && sw == _dwidth)
+      _tft->pushImage(tx, ty, sw, sh, _img8 + (_bitwidth>>3) * _ys, (bool)false );
+    else // Render line by line
+    {
+      _tft->startWrite();
+      while (sh--)
+      {
+        _tft->pushImage(tx, ty++, sw, 1, _img8 + (_bitwidth>>3) * _ys++, (bool)false );
+      }
+      _tft->endWrite();
+    }
+  }
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           setDirtyTracking
+** Description:             Enable or disable recording of changed Sprite areas
+***************************************************************************************/
+void TFT_eSprite::setDirtyTracking(bool enable)
+{
+  _dirtyTrack = enable;
+  _dirtyCount = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           getDirtyTracking
+** Description:             Return true if changed Sprite areas are being recorded
+***************************************************************************************/
+bool TFT_eSprite::getDirtyTracking(void)
+{
+  return _dirtyTrack;
+}
+
+
+/***************************************************************************************
+** Function name:           markDirty
+** Description:             Record an area as changed, same coordinates as fillRect()
+***************************************************************************************/
+void TFT_eSprite::markDirty(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  if (!_created || !_dirtyTrack || (w < 1) || (h < 1)) return;
+
+  x+= _xDatum;
+  y+= _yDatum;
+
+  dirtyArea(x, y, x + w - 1, y + h - 1);
+}
+
+
+/***************************************************************************************
+** Function name:           clearDirty
+** Description:             Discard the recorded dirty rectangles
+***************************************************************************************/
+void TFT_eSprite::clearDirty(void)
+{
+  _dirtyCount = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           getDirtyCount
+** Description:             Return the number of dirty rectangles recorded
+***************************************************************************************/
+uint8_t TFT_eSprite::getDirtyCount(void)
+{
+  return _dirtyCount;
+}
+
+
+/***************************************************************************************
+** Function name:           getDirtyBounds
+** Description:             Get the bounding box of the dirty rectangles
+***************************************************************************************/
+bool TFT_eSprite::getDirtyBounds(int32_t *x, int32_t *y, int32_t *w, int32_t *h)
+{
+  if (!_dirtyCount) return false;
+
+  int32_t x0 = _dirty[0].x0, y0 = _dirty[0].y0;
+  int32_t x1 = _dirty[0].x1, y1 = _dirty[0].y1;
+
+  for (uint8_t i = 1; i < _dirtyCount; i++)
+  {
+    if (_dirty[i].x0 < x0) x0 = _dirty[i].x0;
+    if (_dirty[i].y0 < y0) y0 = _dirty[i].y0;
+    if (_dirty[i].x1 > x1) x1 = _dirty[i].x1;
+    if (_dirty[i].y1 > y1) y1 = _dirty[i].y1;
+  }
+
+  *x = x0;
+  *y = y0;
+  *w = x1 - x0 + 1;
+  *h = y1 - y0 + 1;
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           dirtyWaste
+** Description:             Pixels pushed unnecessarily if rectangle r is merged with area
+***************************************************************************************/
+int32_t TFT_eSprite::dirtyWaste(const dirtyRect_t *r, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+  // Union bounding box
+  int32_t ux0 = (r->x0 < x0) ? r->x0 : x0;
+  int32_t uy0 = (r->y0 < y0) ? r->y0 : y0;
+  int32_t ux1 = (r->x1 > x1) ? r->x1 : x1;
+  int32_t uy1 = (r->y1 > y1) ? r->y1 : y1;
+
+  // Overlap, may be negative
+  int32_t ow = ((r->x1 < x1) ? r->x1 : x1) - ((r->x0 > x0) ? r->x0 : x0) + 1;
+  int32_t oh = ((r->y1 < y1) ? r->y1 : y1) - ((r->y0 > y0) ? r->y0 : y0) + 1;
+
+  int32_t waste = (ux1 - ux0 + 1) * (uy1 - uy0 + 1);
+  waste -= (r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+  waste -= (x1 - x0 + 1) * (y1 - y0 + 1);
+  if ((ow > 0) && (oh > 0)) waste += ow * oh;
+
+  return waste;
+}
+
+
+/***************************************************************************************
+** Function name:           memoryArea
+** Description:             Convert 1bpp area corners to the Sprite memory frame
+***************************************************************************************/
+// Matches the drawPixel() coordinate rotation, corners are inclusive
+void TFT_eSprite::memoryArea(int32_t *x0, int32_t *y0, int32_t *x1, int32_t *y1)
+{
+  int32_t ax0 = *x0, ay0 = *y0, ax1 = *x1, ay1 = *y1;
+
+  if (rotation == 1)
+  {
+    *x0 = _dwidth - ay1 - 1; *x1 = _dwidth - ay0 - 1;
+    *y0 = ax0;               *y1 = ax1;
+  }
+  else if (rotation == 2)
+  {
+    *x0 = _dwidth  - ax1 - 1; *x1 = _dwidth  - ax0 - 1;
+    *y0 = _dheight - ay1 - 1; *y1 = _dheight - ay0 - 1;
+  }
+  else if (rotation == 3)
+  {
+    *x0 = ay0;                *x1 = ay1;
+    *y0 = _dheight - ax1 - 1; *y1 = _dheight - ax0 - 1;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           dirtyArea
+** Description:             Add an area to the dirty rectangle list, merging if needed
+***************************************************************************************/
+// Corners are inclusive and include the datum offsets (i.e. same as clipped fillRect)
+void TFT_eSprite::dirtyArea(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+  // 1bpp Sprite memory is not rotated so convert to memory frame
+  if (_bpp == 1) memoryArea(&x0, &y0, &x1, &y1);
+
+  if (x0 < 0) x0 = 0;
+  if (y0 < 0) y0 = 0;
+  if (x1 >= _dwidth)  x1 = _dwidth  - 1;
+  if (y1 >= _dheight) y1 = _dheight - 1;
+  if ((x0 > x1) || (y0 > y1)) return;
+
+  // Check if already covered, most recent rectangle first as drawing tends to be local
+  for (int32_t i = _dirtyCount - 1; i >= 0; i--)
+  {
+    dirtyRect_t *r = &_dirty[i];
+    if ((x0 >= r->x0) && (x1 <= r->x1) && (y0 >= r->y0) && (y1 <= r->y1)) return;
+  }
+
+  // Find the rectangle that absorbs the new area with the fewest extra pixels
+  int32_t best = -1;
+  int32_t bestWaste = 0;
+  for (int32_t i = 0; i < _dirtyCount; i++)
+  {
+    int32_t waste = dirtyWaste(&_dirty[i], x0, y0, x1, y1);
+    if ((best < 0) || (waste < bestWaste)) { best = i; bestWaste = waste; }
+  }
+
+  // Add a new rectangle if there is space and merging is costly
+  if ((best < 0) || ((bestWaste > SPRITE_DIRTY_SLACK) && (_dirtyCount < SPRITE_DIRTY_RECTS)))
+  {
+    _dirty[_dirtyCount++] = { (int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1 };
+    return;
+  }
+
+  // Grow the best rectangle then absorb any others it now overlaps or nearly overlaps
+  dirtyRect_t *r = &_dirty[best];
+  while (1)
+  {
+    if (x0 < r->x0) r->x0 = x0;
+    if (y0 < r->y0) r->y0 = y0;
+    if (x1 > r->x1) r->x1 = x1;
+    if (y1 > r->y1) r->y1 = y1;
+
+    int32_t j = 0;
+    for (; j < _dirtyCount; j++)
+    {
+      if (j == best) continue;
+      if (dirtyWaste(r, _dirty[j].x0, _dirty[j].y0, _dirty[j].x1, _dirty[j].y1) <= SPRITE_DIRTY_SLACK) break;
+    }
+    if (j == _dirtyCount) return;
+
+    // Remove rectangle j by moving the last one into its slot
+    x0 = _dirty[j].x0; y0 = _dirty[j].y0;
+    x1 = _dirty[j].x1; y1 = _dirty[j].y1;
+    _dirty[j] = _dirty[--_dirtyCount];
+    if (best == _dirtyCount) best = j;
+    r = &_dirty[best];
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           pushDirty
+** Description:             Push the changed areas of the sprite to the TFT at x, y
+***************************************************************************************/
+// The dirty rectangle list is cleared. With dma true, 16bpp sprites are sent using DMA
+// and, as for pushImageDMA(), tft.startWrite() must be called first. Do not change the
+// Sprite content until the transfer has completed (see dmaBusy(), dmaFence() and dmaWait())
+bool TFT_eSprite::pushDirty(int32_t x, int32_t y, bool dma)
+{
+  if (!_created) return false;
+
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+  dma = dma && (_bpp == 16) && _tft->DMA_Enabled;
+#else
+  dma = false;
+#endif
+
+  // A rotated 1bpp Sprite records areas before rotation is applied, so all of it is sent
+  if ((_bpp == 1) && rotation && _dirtyCount)
+  {
+    _dirty[0] = { 0, 0, (int16_t)(_dwidth - 1), (int16_t)(_dheight - 1) };
+    _dirtyCount = 1;
+  }
+
+  bool oldSwapBytes = _tft->getSwapBytes();
+
+  // As for pushImage(), a transaction started by the sketch is left open
+  if (!dma) { _tft->begin_tft_write(); _tft->inTransaction = true; }
+
+  for (uint8_t i = 0; i < _dirtyCount; i++)
+  {
+    dirtyRect_t *r = &_dirty[i];
+    pushArea(x + r->x0, y + r->y0, r->x0, r->y0, r->x1 - r->x0 + 1, r->y1 - r->y0 + 1, dma);
+  }
+
+  if (!dma) { _tft->inTransaction = _tft->lockTransaction; _tft->end_tft_write(); }
+
+  _tft->setSwapBytes(oldSwapBytes);
+
+  _dirtyCount = 0;
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           pushArea
+** Description:             Push the area sx,sy,sw,sh of Sprite memory to the TFT at tx,ty
+***************************************************************************************/
+// Area must be within the Sprite memory, a single TFT window is used. TFT transaction
+// must be started by caller unless dma is true
+void TFT_eSprite::pushArea(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh, bool dma)
+{
+  int32_t x = tx;
+  int32_t y = ty;
+
+  if (!_tft->clipAddrWindow(&x, &y, &sw, &sh)) return;
+
+  // Move the Sprite area origin by the amount clipped off the TFT window
+  sx += x - (tx + _tft->_xDatum);
+  sy += y - (ty + _tft->_yDatum);
+
+  if (_bpp == 16)
+  {
+    uint16_t *ptr = _img + sx + sy * _iwidth;
+
+    _tft->setSwapBytes(false); // Sprite 16bpp colours are stored byte swapped
+
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+    if (dma)
+    {
+      _tft->setAddrWindowDMA(x, y, sw, sh); // Queued behind any transfer still in progress
+      if (sw == _iwidth) _tft->pushPixelsDMA(ptr, sw * sh);
+      else while (sh--) { _tft->pushPixelsDMA(ptr, sw); ptr += _iwidth; }
+      return;
+    }
+#else
+    (void)dma;
+#endif
+
+    _tft->setWindow(x, y, x + sw - 1, y + sh - 1);
+
+    // Rows are contiguous in Sprite memory if the full width is pushed
+    if (sw == _iwidth) _tft->pushPixels(ptr, sw * sh);
+    else while (sh--) { _tft->pushPixels(ptr, sw); ptr += _iwidth; }
+    return;
+  }
+
+  _tft->setWindow(x, y, x + sw - 1, y + sh - 1);
+
+  // 4bpp and 1bpp are expanded with lookup tables
+  if (_bpp == 1)
+  {
+    _tft->pushPaletteLines(_img8, _bitwidth, sx, sy, sw, sh, nullptr, false);
+    return;
+  }
+
+  if (_bpp == 4)
+  {
+    uint32_t *lut = _tft->paletteLUT(_colorMap);
+    if (lut)
+    {
+      _tft->pushPaletteLines(_img4, _iwidth, sx, sy, sw, sh, lut, false);
+      return;
+    }
+  }
+
+  // Otherwise convert to 16bpp in blocks of up to 64 pixels so stack use is bounded
+  uint16_t lineBuf[64];
+  uint8_t  blue[] = {0, 11, 21, 31};
+
+  _tft->setSwapBytes(true);
+
+  while (sh--)
+  {
+    for (int32_t bx = 0; bx < sw; bx += 64)
+    {
+      int32_t n = (sw - bx < 64) ? sw - bx : 64;
+      int32_t xy = sx + bx + sy * _iwidth;
+
+      if (_bpp == 8)
+      {
+        uint8_t *ptr = _img8 + xy;
+        for (int32_t i = 0; i < n; i++)
+        {
+          uint16_t color = ptr[i];
+          if (_colorMap) lineBuf[i] = _colorMap[color];
+          else lineBuf[i] = (color & 0xE0)<<8 | (color & 0xC0)<<5
+                          | (color & 0x1C)<<6 | (color & 0x1C)<<3
+                          | blue[color & 0x03];
+        }
+      }
+      else // 4bpp
+      {
+        for (int32_t i = 0; i < n; i++, xy++)
+        {
+          if ((xy & 0x01) == 0) lineBuf[i] = _colorMap[_img4[xy>>1] >> 4];   // even index = bits 7 .. 4
+          else                  lineBuf[i] = _colorMap[_img4[xy>>1] & 0x0F]; // odd index = bits 3 .. 0.
+        }
+      }
+      _tft->pushPixels(lineBuf, n);
+    }
+    sy++;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           diffFwd
+** Description:             Return index of first byte from i that differs, or n if none
+***************************************************************************************/
+// Buffers a and b must have the same 32-bit alignment
+static inline int32_t diffFwd(const uint8_t *a, const uint8_t *b, int32_t i, int32_t n)
+{
+  // Bytes up to a 32-bit boundary
+  while ((i < n) && ((uintptr_t)(a + i) & 0x3)) {
+    if (a[i] != b[i]) return i;
+    i++;
+  }
+
+  // Compare 32 bits at a time
+  while ((i + 4 <= n) && (*(const uint32_t*)(a + i) == *(const uint32_t*)(b + i))) i += 4;
+
+  while (i < n) {
+    if (a[i] != b[i]) return i;
+    i++;
+  }
+
+  return n;
+}
+
+
+/***************************************************************************************
+** Function name:           diffRev
+** Description:             Return index of last byte up to i that differs, or -1 if none
+***************************************************************************************/
+static inline int32_t diffRev(const uint8_t *a, const uint8_t *b, int32_t i)
+{
+  while ((i >= 0) && ((uintptr_t)(a + i + 1) & 0x3)) {
+    if (a[i] != b[i]) return i;
+    i--;
+  }
+
+  while ((i >= 3) && (*(const uint32_t*)(a + i - 3) == *(const uint32_t*)(b + i - 3))) i -= 4;
+
+  while (i >= 0) {
+    if (a[i] != b[i]) return i;
+    i--;
+  }
+
+  return -1;
 }
 
 
 /***************************************************************************************
-** Function name:           pushSprite
-** Description:             Push a cropped sprite to the TFT at tx, ty
+** Function name:           pushDiff
+** Description:             Push the pixels that differ from the other frame to the TFT
 ***************************************************************************************/
-bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh)
+bool TFT_eSprite::pushDiff(int32_t x, int32_t y)
 {
   if (!_created) return false;
 
-  // Perform window boundary checks and crop if needed
-  setWindow(sx, sy, sx + sw - 1, sy + sh - 1);
+  uint8_t *cur  = _img8;
+  uint8_t *prev = (_img8 == _img8_1) ? _img8_2 : _img8_1;
 
-  /* These global variables are now populated for the sprite
-  _xs = x start coordinate
-  _ys = y start coordinate
-  _xe = x end coordinate (inclusive)
-  _ye = y end coordinate (inclusive)
-  */
+  int32_t stride;   // Bytes per line in Sprite memory
+  int32_t lineLen;  // Bytes per line holding visible pixels
+  int32_t gap;      // Unchanged bytes allowed within a run
 
-  // Calculate new sprite window bounding box width and height
-  sw = _xe - _xs + 1;
-  sh = _ye - _ys + 1;
+  if (_bpp == 16)     { stride = _iwidth << 1;   lineLen = _dwidth << 1;       gap = SPRITE_DIFF_GAP << 1; }
+  else if (_bpp == 8) { stride = _iwidth;        lineLen = _dwidth;            gap = SPRITE_DIFF_GAP; }
+  else                { stride = _bitwidth >> 3; lineLen = (_dwidth + 7) >> 3; gap = (SPRITE_DIFF_GAP + 7) >> 3; }
 
-  if (_ys >= _iheight) return false;
+  // Nothing to compare with so send it all
+  if ((cur == prev) || (_bpp == 4)) {
+    pushSprite(x, y);
+    if (cur != prev) memcpy(prev, cur, stride * _dheight);
+    return true;
+  }
 
-  if (_bpp == 16)
+  // Estimate the pixels to send from the first and last changed bytes in each line, each
+  // window costs about as much as SPRITE_DIFF_GAP pixels
+  uint32_t limit   = (uint32_t)_dwidth * _dheight * SPRITE_DIFF_FULL / 100;
+  uint32_t changed = 0;
+  for (int32_t ys = 0; ys < _dheight; ys++)
   {
-    bool oldSwapBytes = _tft->getSwapBytes();
-    _tft->setSwapBytes(false);
+    uint8_t *a = cur  + ys * stride;
+    uint8_t *b = prev + ys * stride;
+    int32_t s = diffFwd(a, b, 0, lineLen);
+    if (s == lineLen) continue;
+    int32_t e = diffRev(a, b, lineLen - 1);
+    if (_bpp == 16) changed += ((e - s) >> 1) + 1;
+    else if (_bpp == 8) changed += e - s + 1;
+    else changed += (e - s + 1) << 3;
+    changed += SPRITE_DIFF_GAP;
+    if (changed >= limit) break;
+  }
 
-    // Check if a faster block copy to screen is possible
-    if ( sx == 0 && sw == _dwidth)
-      _tft->pushImage(tx, ty, sw, sh, _img + _iwidth * _ys );
-    else // Render line by line
-      while (sh--)
-        _tft->pushImage(tx, ty++, sw, 1, _img + _xs + _iwidth * _ys++ );
+  if (changed == 0) return true;
 
-    _tft->setSwapBytes(oldSwapBytes);
+  if (changed >= limit) {
+    pushSprite(x, y);
+    memcpy(prev, cur, stride * _dheight);
+    return true;
   }
-  else if (_bpp == 8)
-  {
-    // Check if a faster block copy to screen is possible
-    if ( sx == 0 && sw == _dwidth)
-      _tft->pushImage(tx, ty, sw, sh, _img8 + _iwidth * _ys, (bool)true );
-    else // Render line by line
-    while (sh--)
-      _tft->pushImage(tx, ty++, sw, 1, _img8 + _xs + _iwidth * _ys++, (bool)true );
-  }
-  else if (_bpp == 4)
-  {
-    // Check if a faster block copy to screen is possible
-    if ( sx == 0 && sw == _dwidth)
-      _tft->pushImage(tx, ty, sw, sh, _img4 + (_iwidth>>1) * _ys, false, _colorMap );
-    else // Render line by line
-    {
-      int32_t ds = _xs&1; // Odd x start pixel
 
-      int32_t de = 0;     // Odd x end pixel
-      if ((sw > ds) && (_xe&1)) de = 1;
+  bool oldSwapBytes = _tft->getSwapBytes();
 
-      uint32_t dm = 0;     // Midsection pixel count
-      if (sw > (ds+de)) dm = sw - ds - de;
-      sw--;
+  // As for pushImage(), a transaction started by the sketch is left open
+  _tft->begin_tft_write();
+  _tft->inTransaction = true;
 
-      uint32_t yp = (_xs + ds + _iwidth * _ys)>>1;
-      _tft->startWrite();
-      while (sh--)
-      {
-        if (ds) _tft->drawPixel(tx, ty, readPixel(_xs, _ys) );
-        if (dm) _tft->pushImage(tx + ds, ty, dm, 1, _img4 + yp, false, _colorMap );
-        if (de) _tft->drawPixel(tx + sw, ty, readPixel(_xe, _ys) );
-        _ys++;
-        ty++;
-        yp += (_iwidth>>1);
-      }
-      _tft->endWrite();
-    }
-  }
-  else // 1bpp
+  // Runs in consecutive lines with the same x extent are sent in one window
+  int32_t bx = 0, bw = 0, by = 0, bh = 0;
+
+  for (int32_t ys = 0; ys < _dheight; ys++)
   {
-    // Check if a faster block copy to screen is possible
-    if ( sx == 0 && sw == _dwidth)
-      _tft->pushImage(tx, ty, sw, sh, _img8 + (_bitwidth>>3) * _ys, (bool)false );
-    else // Render line by line
+    uint8_t *a = cur  + ys * stride;
+    uint8_t *b = prev + ys * stride;
+    int32_t s = diffFwd(a, b, 0, lineLen);
+
+    while (s < lineLen)
     {
-      _tft->startWrite();
-      while (sh--)
-      {
-        _tft->pushImage(tx, ty++, sw, 1, _img8 + (_bitwidth>>3) * _ys++, (bool)false );
+      // Extend the run over changed bytes and short unchanged gaps
+      int32_t e = s;
+      while (1) {
+        int32_t n = diffFwd(a, b, e + 1, lineLen);
+        if ((n == lineLen) || (n - e - 1 > gap)) break;
+        e = n;
       }
-      _tft->endWrite();
+
+      // Old frame now matches what is being sent
+      memcpy(b + s, a + s, e - s + 1);
+
+      // Convert byte run to pixels
+      int32_t xs, xe;
+      if (_bpp == 16)     { xs = s >> 1; xe = e >> 1; }
+      else if (_bpp == 8) { xs = s;      xe = e; }
+      else                { xs = s << 3; xe = (e << 3) + 7; if (xe >= _dwidth) xe = _dwidth - 1; }
+
+      if (bh && (xs == bx) && (xe - xs + 1 == bw) && (ys == by + bh)) bh++;
+      else {
+        if (bh) pushArea(x + bx, y + by, bx, by, bw, bh, false);
+        bx = xs; bw = xe - xs + 1; by = ys; bh = 1;
+      }
+
+      s = diffFwd(a, b, e + 1, lineLen);
     }
   }
 
+  if (bh) pushArea(x + bx, y + by, bx, by, bw, bh, false);
+
+  _tft->inTransaction = _tft->lockTransaction;
+  _tft->end_tft_write();
+  _tft->setSwapBytes(oldSwapBytes);
+
   return true;
 }
 
@@ -976,6 +2281,7 @@ uint16_t TFT_eSprite::readPixel(int32_t x, int32_t y)
   if (_bpp == 8)
   {
     uint16_t color = _img8[x + y * _iwidth];
+    if (_colorMap) return _colorMap[color];
     if (color != 0)
     {
     uint8_t  blue[] = {0, 11, 21, 31};
@@ -1024,6 +2330,39 @@ uint16_t TFT_eSprite::readPixel(int32_t x, int32_t y)
 }
 
 
+/***************************************************************************************
+** Function name:           readSpan
+** Description:             Read a line of n pixel colours at x,y
+***************************************************************************************/
+// Colours are returned in 565 format (not byte swapped)
+void TFT_eSprite::readSpan(int32_t x, int32_t y, int32_t n, uint16_t *data)
+{
+  while (n--) *data++ = readPixel(x++, y);
+}
+
+
+/***************************************************************************************
+** Function name:           writeSpan
+** Description:             Write a line of n pixel colours at x,y
+***************************************************************************************/
+// Colours are in 565 format (not byte swapped), the line is clipped to the viewport
+void TFT_eSprite::writeSpan(int32_t x, int32_t y, int32_t n, uint16_t *data)
+{
+  if (_bpp == 16 || _bpp == 8)
+  {
+    // Spans carry graphics and text colours, only images pushed by the sketch are dithered
+    bool    swap   = _swapBytes;
+    uint8_t dither = _dither;
+    _swapBytes = true;
+    _dither    = 0;
+    pushImage(x, y, n, 1, data);
+    _swapBytes = swap;
+    _dither    = dither;
+  }
+  else while (n--) drawPixel(x++, y, *data++);
+}
+
+
 /***************************************************************************************
 ** Function name:           pushImage
 ** Description:             push image into a defined area of a sprite
@@ -1034,6 +2373,8 @@ void  TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_
 
   PI_CLIP;
 
+  if (_dirtyTrack) dirtyArea(x, y, x + dw - 1, y + dh - 1);
+
   if (_bpp == 16) // Plot a 16 bpp image into a 16 bpp Sprite
   {
     // Pointer within original image
@@ -1083,7 +2424,8 @@ void  TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_
   else if (_bpp == 8) // Plot a 16 bpp image into a 8 bpp Sprite
   {
     uint16_t lastColor = 0;
-    uint8_t  color8    = 0;
+    uint8_t  pixel8    = color8(0);
+    bool     dither    = _colorIndex && _dither;
     for (int32_t yp = dy; yp < dy + dh; yp++)
     {
       int32_t xyw = x + y * _iwidth;
@@ -1091,13 +2433,20 @@ void  TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_
       for (int32_t xp = dx; xp < dx + dw; xp++)
       {
         uint16_t color = data[dxypw++];
+        if (dither) {
+          if (!_swapBytes) color = color>>8 | color<<8;
+          _img8[xyw] = ditherColor8(color, xyw - y * _iwidth, y);
+          xyw++;
+          continue;
+        }
         if (color != lastColor) {
           // When data source is a sprite, the bytes are already swapped
-          if(!_swapBytes) color8 = (uint8_t)((color & 0xE0) | (color & 0x07)<<2 | (color & 0x1800)>>11);
-          else color8 = (uint8_t)((color & 0xE000)>>8 | (color & 0x0700)>>6 | (color & 0x0018)>>3);
+          if (_colorIndex) pixel8 = color8(_swapBytes ? color : (uint16_t)(color>>8 | color<<8));
+          else if(!_swapBytes) pixel8 = (uint8_t)((color & 0xE0) | (color & 0x07)<<2 | (color & 0x1800)>>11);
+          else pixel8 = (uint8_t)((color & 0xE000)>>8 | (color & 0x0700)>>6 | (color & 0x0018)>>3);
         }
         lastColor = color;
-        _img8[xyw++] = color8;
+        _img8[xyw++] = pixel8;
       }
       y++;
     }
@@ -1177,6 +2526,8 @@ void  TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const u
 
   PI_CLIP;
 
+  if (_dirtyTrack) dirtyArea(x, y, x + dw - 1, y + dh - 1);
+
   if (_bpp == 16) // Plot a 16 bpp image into a 16 bpp Sprite
   {
     for (int32_t yp = dy; yp < dy + dh; yp++)
@@ -1202,7 +2553,7 @@ void  TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const u
       {
         uint16_t color = pgm_read_word(data + xp + yp * w);
         if(_swapBytes) color = color<<8 | color>>8;
-        _img8[ox + y * _iwidth] = (uint8_t)((color & 0xE000)>>8 | (color & 0x0700)>>6 | (color & 0x0018)>>3);
+        _img8[ox + y * _iwidth] = (_colorIndex && _dither) ? ditherColor8(color, ox, y) : color8(color);
         ox++;
       }
       y++;
@@ -1276,6 +2627,9 @@ void TFT_eSprite::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
     _ys = y0;
     _xe = x1;
     _ye = y1;
+
+    // Pixels written to the window are not tracked one by one
+    if (_dirtyTrack) dirtyArea(x0, y0, x1, y1);
   }
 
   _xptr = _xs;
@@ -1296,7 +2650,7 @@ void TFT_eSprite::pushColor(uint16_t color)
     _img [_xptr + _yptr * _iwidth] = (uint16_t) (color >> 8) | (color << 8);
 
   else  if (_bpp == 8)
-    _img8[_xptr + _yptr * _iwidth] = (uint8_t )((color & 0xE000)>>8 | (color & 0x0700)>>6 | (color & 0x0018)>>3);
+    _img8[_xptr + _yptr * _iwidth] = color8(color);
 
   else if (_bpp == 4)
   {
@@ -1339,7 +2693,7 @@ void TFT_eSprite::pushColor(uint16_t color, uint32_t len)
     pixelColor = (uint16_t) (color >> 8) | (color << 8);
 
   else  if (_bpp == 8)
-    pixelColor = (color & 0xE000)>>8 | (color & 0x0700)>>6 | (color & 0x0018)>>3;
+    pixelColor = color8(color);
 
   else pixelColor = (uint16_t) color; // for 1bpp or 4bpp
 
@@ -1423,6 +2777,8 @@ void TFT_eSprite::scroll(int16_t dx, int16_t dy)
     return;
   }
 
+  if (_dirtyTrack) dirtyArea(_sx, _sy, _sx + _sw - 1, _sy + _sh - 1);
+
   // Fetch the scroll area width and height set by setScrollRect()
   uint32_t w  = _sw - abs(dx); // line width to copy
   uint32_t h  = _sh - abs(dy); // lines to copy
@@ -1520,6 +2876,11 @@ void TFT_eSprite::fillSprite(uint32_t color)
   // Use memset if possible as it is super fast
   if(_xDatum == 0 && _yDatum == 0  &&  _xWidth == width())
   {
+    if (_dirtyTrack) { // Whole Sprite memory is changed
+      _dirty[0] = { 0, 0, (int16_t)(_dwidth - 1), (int16_t)(_dheight - 1) };
+      _dirtyCount = 1;
+    }
+
     if(_bpp == 16) {
       if ( (uint8_t)color == (uint8_t)(color>>8) ) {
         memset(_img,  (uint8_t)color, _iwidth * _yHeight * 2);
@@ -1528,8 +2889,7 @@ void TFT_eSprite::fillSprite(uint32_t color)
     }
     else if (_bpp == 8)
     {
-      color = (color & 0xE000)>>8 | (color & 0x0700)>>6 | (color & 0x0018)>>3;
-      memset(_img8, (uint8_t)color, _iwidth * _yHeight);
+      memset(_img8, color8(color), _iwidth * _yHeight);
     }
     else if (_bpp == 4)
     {
@@ -1637,6 +2997,8 @@ void TFT_eSprite::drawPixel(int32_t x, int32_t y, uint32_t color)
   // Range checking
   if ((x < _vpX) || (y < _vpY) ||(x >= _vpW) || (y >= _vpH)) return;
 
+  if (_dirtyTrack) dirtyArea(x, y, x, y);
+
   if (_bpp == 16)
   {
     color = (color >> 8) | (color << 8);
@@ -1644,7 +3006,7 @@ void TFT_eSprite::drawPixel(int32_t x, int32_t y, uint32_t color)
   }
   else if (_bpp == 8)
   {
-    _img8[x+y*_iwidth] = (uint8_t)((color & 0xE000)>>8 | (color & 0x0700)>>6 | (color & 0x0018)>>3);
+    _img8[x+y*_iwidth] = color8(color);
   }
   else if (_bpp == 4)
   {
@@ -1741,6 +3103,110 @@ void TFT_eSprite::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint3
 }
 
 
+/***************************************************************************************
+** Function name:           spriteFill16
+** Description:             Fill n 16-bit pixels using 32-bit stores where aligned
+***************************************************************************************/
+static inline void spriteFill16(uint16_t *ptr, uint16_t color, uint32_t n)
+{
+  // memset is fastest if both colour bytes are the same (e.g. black and white)
+  if ((uint8_t)color == (uint8_t)(color >> 8)) { memset(ptr, (uint8_t)color, n << 1); return; }
+
+  // Head pixel to reach a 32-bit boundary
+  if (n && ((uintptr_t)ptr & 0x2)) { *ptr++ = color; n--; }
+
+  uint32_t  c32 = color | (uint32_t)color << 16;
+  uint32_t *p32 = (uint32_t*)ptr;
+  uint32_t  n32 = n >> 1;
+
+  while (n32 >= 4) {
+    p32[0] = c32; p32[1] = c32; p32[2] = c32; p32[3] = c32;
+    p32 += 4;
+    n32 -= 4;
+  }
+  while (n32--) *p32++ = c32;
+
+  // Tail pixel
+  if (n & 1) *(uint16_t*)p32 = color;
+}
+
+
+/***************************************************************************************
+** Function name:           spriteFill4
+** Description:             Fill w 4-bit pixels from x in a line of a 4bpp Sprite
+***************************************************************************************/
+static inline void spriteFill4(uint8_t *line, int32_t x, int32_t w, uint8_t c)
+{
+  uint8_t *ptr = line + (x >> 1);
+
+  // Odd x start pixel is in the low nibble
+  if (x & 1) { *ptr = (*ptr & 0xF0) | c; ptr++; w--; }
+
+  if (w > 1) { memset(ptr, c | (c << 4), w >> 1); ptr += w >> 1; }
+
+  // Odd end pixel is in the high nibble
+  if (w & 1) *ptr = (*ptr & 0x0F) | (c << 4);
+}
+
+
+/***************************************************************************************
+** Function name:           spriteFill1
+** Description:             Set or clear w bits from bit x in a line of a 1bpp Sprite
+***************************************************************************************/
+static inline void spriteFill1(uint8_t *line, int32_t x, int32_t w, bool set)
+{
+  uint8_t *ptr = line + (x >> 3);
+  uint8_t  s   = x & 7;
+
+  // Run within a single byte
+  if (s + w <= 8)
+  {
+    uint8_t mask = (0xFF >> s) & ~(0xFF >> (s + w));
+    if (set) *ptr |= mask; else *ptr &= ~mask;
+    return;
+  }
+
+  // Head bits
+  if (s)
+  {
+    uint8_t mask = 0xFF >> s;
+    if (set) *ptr |= mask; else *ptr &= ~mask;
+    ptr++;
+    w -= 8 - s;
+  }
+
+  // Whole bytes
+  if (w >= 8) { memset(ptr, set ? 0xFF : 0x00, w >> 3); ptr += w >> 3; }
+
+  // Tail bits
+  if (w & 7)
+  {
+    uint8_t mask = ~(0xFF >> (w & 7));
+    if (set) *ptr |= mask; else *ptr &= ~mask;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           fillArea1
+** Description:             Fill an area of a 1bpp Sprite
+***************************************************************************************/
+// Corners are inclusive, include datum offsets and must be within the Sprite
+void TFT_eSprite::fillArea1(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color)
+{
+  memoryArea(&x0, &y0, &x1, &y1);
+
+  int32_t  bw  = _bitwidth >> 3;
+  uint8_t *ptr = _img8 + bw * y0;
+
+  while (y0++ <= y1)
+  {
+    spriteFill1(ptr, x0, x1 - x0 + 1, color);
+    ptr += bw;
+  }
+}
+
+
 /***************************************************************************************
 ** Function name:           drawFastVLine
 ** Description:             draw a vertical line
@@ -1761,6 +3227,8 @@ void TFT_eSprite::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
 
   if (h < 1) return;
 
+  if (_dirtyTrack) dirtyArea(x, y, x, y + h - 1);
+
   if (_bpp == 16)
   {
     color = (color >> 8) | (color << 8);
@@ -1769,7 +3237,7 @@ void TFT_eSprite::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
   }
   else if (_bpp == 8)
   {
-    color = (color & 0xE000)>>8 | (color & 0x0700)>>6 | (color & 0x0018)>>3;
+    color = color8(color);
     while (h--) _img8[x + _iwidth * y++] = (uint8_t) color;
   }
   else if (_bpp == 4)
@@ -1790,15 +3258,7 @@ void TFT_eSprite::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
       }
     }
   }
-  else
-  {
-    x -= _xDatum; // Remove any offset as it will be added by drawPixel
-    y -= _yDatum;
-    while (h--)
-    {
-      drawPixel(x, y++, color);
-    }
-  }
+  else fillArea1(x, y, x, y + h - 1, color);
 }
 
 
@@ -1822,46 +3282,23 @@ void TFT_eSprite::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
 
   if (w < 1) return;
 
+  if (_dirtyTrack) dirtyArea(x, y, x + w - 1, y);
+
   if (_bpp == 16)
   {
     color = (color >> 8) | (color << 8);
-    while (w--) _img[_iwidth * y + x++] = (uint16_t) color;
+    spriteFill16(_img + _iwidth * y + x, (uint16_t) color, w);
   }
   else if (_bpp == 8)
   {
-    color = (color & 0xE000)>>8 | (color & 0x0700)>>6 | (color & 0x0018)>>3;
+    color = color8(color);
     memset(_img8+_iwidth * y + x, (uint8_t)color, w);
   }
   else if (_bpp == 4)
   {
-    uint8_t c = (uint8_t)color & 0x0F;
-    uint8_t c2 = (c | ((c << 4) & 0xF0));
-    if ((x & 0x01) == 1)
-    {
-      drawPixel(x - _xDatum, y - _yDatum, color);
-      x++; w--;
-      if (w < 1)
-        return;
-    }
-
-    if (((w + x) & 0x01) == 1)
-    {
-      // handle the extra one at the other end
-      drawPixel(x - _xDatum + w - 1, y - _yDatum, color);
-      w--;
-      if (w < 1) return;
-    }
-    memset(_img4 + ((_iwidth * y + x) >> 1), c2, (w >> 1));
-  }
-  else {
-    x -= _xDatum; // Remove any offset as it will be added by drawPixel
-    y -= _yDatum;
-
-    while (w--)
-    {
-      drawPixel(x++, y, color);
-    }
+    spriteFill4(_img4 + ((_iwidth * y) >> 1), x, w, (uint8_t)color & 0x0F);
   }
+  else fillArea1(x, y, x + w - 1, y, color);
 }
 
 
@@ -1887,24 +3324,22 @@ void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t
 
   if ((w < 1) || (h < 1)) return;
 
+  if (_dirtyTrack) dirtyArea(x, y, x + w - 1, y + h - 1);
+
   int32_t yp = _iwidth * y + x;
 
   if (_bpp == 16)
   {
     color = (color >> 8) | (color << 8);
-    uint32_t iw = w;
-    int32_t ys = yp;
-    if(h--)  {while (iw--) _img[yp++] = (uint16_t) color;}
-    yp = ys;
     while (h--)
     {
+      spriteFill16(_img + yp, (uint16_t) color, w);
       yp += _iwidth;
-      memcpy( _img+yp, _img+ys, w<<1);
     }
   }
   else if (_bpp == 8)
   {
-    color = (color & 0xE000)>>8 | (color & 0x0700)>>6 | (color & 0x0018)>>3;
+    color = color8(color);
     while (h--)
     {
       memset(_img8 + yp, (uint8_t)color, w);
@@ -1913,67 +3348,14 @@ void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t
   }
   else if (_bpp == 4)
   {
-    uint8_t c1 = (uint8_t)color & 0x0F;
-    uint8_t c2 = c1 | ((c1 << 4) & 0xF0);
-    if ((x & 0x01) == 0 && (w & 0x01) == 0)
-    {
-      yp = (yp >> 1);
-      while (h--)
-      {
-        memset(_img4 + yp, c2, (w>>1));
-        yp += (_iwidth >> 1);
-      }
-    }
-    else if ((x & 0x01) == 0)
-    {
-
-      // same as above but you have a hangover on the right.
-      yp = (yp >> 1);
-      while (h--)
-      {
-        if (w > 1)
-          memset(_img4 + yp, c2, (w-1)>>1);
-        // handle the rightmost pixel by calling drawPixel
-        drawPixel(x+w-1-_xDatum, y+h-_yDatum, c1);
-        yp += (_iwidth >> 1);
-      }
-    }
-    else if ((w & 0x01) == 1)
-    {
-      yp = (yp + 1) >> 1;
-      while (h--) {
-        drawPixel(x-_xDatum, y+h-_yDatum, color & 0x0F);
-        if (w > 1)
-          memset(_img4 + yp, c2, (w-1)>>1);
-        // same as above but you have a hangover on the left instead
-        yp += (_iwidth >> 1);
-      }
-    }
-    else
-    {
-      yp = (yp + 1) >> 1;
-      while (h--) {
-        drawPixel(x-_xDatum, y+h-_yDatum, color & 0x0F);
-        if (w > 1) drawPixel(x+w-1-_xDatum, y+h-_yDatum, color & 0x0F);
-        if (w > 2)
-          memset(_img4 + yp, c2, (w-2)>>1);
-        // maximal hacking, single pixels on left and right.
-        yp += (_iwidth >> 1);
-      }
-    }
-  }
-  else
-  {
-    x -= _xDatum;
-    y -= _yDatum;
+    uint8_t *ptr = _img4 + ((_iwidth * y) >> 1);
     while (h--)
     {
-      int32_t ww = w;
-      int32_t xx = x;
-      while (ww--) drawPixel(xx++, y, color);
-      y++;
+      spriteFill4(ptr, x, w, (uint8_t)color & 0x0F);
+      ptr += (_iwidth >> 1);
     }
   }
+  else fillArea1(x, y, x + w - 1, y + h - 1, color);
 }
 
 
@@ -2032,28 +3414,21 @@ void TFT_eSprite::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uin
   }
   else
   {
-    for (int8_t i = 0; i < 6; i++ ) {
-      uint8_t line;
-      if (i == 5)
-        line = 0x0;
-      else
-        line = pgm_read_byte(font + (c * 5) + i);
+    uint8_t column[6];
+    for (int8_t i = 0; i < 5; i++ ) column[i] = pgm_read_byte(font + (c * 5) + i);
+    column[5] = 0;
 
-      if (size == 1) // default size
-      {
+    if (size == 1) // default size
+    {
+      for (int8_t i = 0; i < 6; i++ ) {
+        uint8_t line = column[i];
         for (int8_t j = 0; j < 8; j++) {
           if (line & 0x1) drawPixel(x + i, y + j, color);
           line >>= 1;
         }
       }
-      else {  // big size
-        for (int8_t j = 0; j < 8; j++) {
-          if (line & 0x1) fillRect(x + (i * size), y + (j * size), size, size, color);
-          else if (fillbg) fillRect(x + i * size, y + j * size, size, size, bg);
-          line >>= 1;
-        }
-      }
     }
+    else drawGlcdRuns(column, 6, x, y, color, bg, size); // big size
   }
 
 //>>>>>>>>>>>>>>>>>>>>>>>>>>>
@@ -2274,119 +3649,36 @@ int16_t TFT_eSprite::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t fo
 #ifdef LOAD_RLE  //674 bytes of code
   // Font is not 2 and hence is RLE encoded
   {
-    w *= height; // Now w is total number of pixels in the character
-    int16_t color = textcolor;
-    if (_bpp == 16) color = (textcolor >> 8) | (textcolor << 8);
-    else if (_bpp == 8) color = ((textcolor & 0xE000)>>8 | (textcolor & 0x0700)>>6 | (textcolor & 0x0018)>>3);
-
-    int16_t bgcolor = textbgcolor;
-    if (_bpp == 16) bgcolor = (textbgcolor >> 8) | (textbgcolor << 8);
-    else if (_bpp == 8) bgcolor = ((textbgcolor & 0xE000)>>8 | (textbgcolor & 0x0700)>>6 | (textbgcolor & 0x0018)>>3);
-
-    if (textcolor == textbgcolor && !clip && _bpp != 1) {
-      int32_t px = 0, py = pY; // To hold character block start and end column and row values
-      int32_t pc = 0; // Pixel count
-      uint8_t np = textsize * textsize; // Number of pixels in a drawn pixel
-
-      uint8_t tnp = 0; // Temporary copy of np for while loop
-      uint8_t ts = textsize - 1; // Temporary copy of textsize
-      // 16-bit pixel count so maximum font size is equivalent to 180x180 pixels in area
-      // w is total number of pixels to plot to fill character block
-      while (pc < w) {
-        line = pgm_read_byte((uint8_t *)flash_address);
-        flash_address++;
-        if (line & 0x80) {
-          line &= 0x7F;
-          line++;
-          if (ts) {
-            px = xd + textsize * (pc % width); // Keep these px and py calculations outside the loop as they are slow
-            py = yd + textsize * (pc / width);
-          }
-          else {
-            px = xd + pc % width; // Keep these px and py calculations outside the loop as they are slow
-            py = yd + pc / width;
-          }
-          while (line--) { // In this case the while(line--) is faster
-            pc++; // This is faster than putting pc+=line before while()?
-            setWindow(px, py, px + ts, py + ts);
+    // Text colour != background and textsize = 1 and character is within viewport area
+    // so use faster drawing of characters and background using block write
+    if (textcolor != textbgcolor && textsize == 1 && !clip && _bpp != 1)
+    {
+      w *= height; // Now w is total number of pixels in the character
+      int16_t color = textcolor;
+      if (_bpp == 16) color = (textcolor >> 8) | (textcolor << 8);
+      else if (_bpp == 8) color = color8(textcolor);
 
-            if (ts) {
-              tnp = np;
-              while (tnp--) writeColor(color);
-            }
-            else writeColor(color);
+      int16_t bgcolor = textbgcolor;
+      if (_bpp == 16) bgcolor = (textbgcolor >> 8) | (textbgcolor << 8);
+      else if (_bpp == 8) bgcolor = color8(textbgcolor);
 
-            px += textsize;
+      setWindow(xd, yd, xd + width - 1, yd + height - 1);
 
-            if (px >= (xd + width * textsize)) {
-              px = xd;
-              py += textsize;
-            }
-          }
+      // Maximum font size is equivalent to 180x180 pixels in area
+      while (w > 0) {
+        line = pgm_read_byte((uint8_t *)flash_address++); // 8 bytes smaller when incrementing here
+        if (line & 0x80) {
+          line &= 0x7F;
+          line++; w -= line;
+          while (line--) writeColor(color);
         }
         else {
-          line++;
-          pc += line;
-        }
-      }
-    }
-    else {
-      // Text colour != background and textsize = 1 and character is within viewport area
-      // so use faster drawing of characters and background using block write
-      if (textcolor != textbgcolor && textsize == 1 && !clip && _bpp != 1)
-      {
-        setWindow(xd, yd, xd + width - 1, yd + height - 1);
-
-        // Maximum font size is equivalent to 180x180 pixels in area
-        while (w > 0) {
-          line = pgm_read_byte((uint8_t *)flash_address++); // 8 bytes smaller when incrementing here
-          if (line & 0x80) {
-            line &= 0x7F;
-            line++; w -= line;
-            while (line--) writeColor(color);
-          }
-          else {
-            line++; w -= line;
-            while (line--) writeColor(bgcolor);
-          }
-        }
-      }
-      else
-      {
-        int32_t px = 0, py = 0;  // To hold character pixel coords
-        int32_t tx = 0, ty = 0;  // To hold character TFT pixel coords
-        int32_t pc = 0;          // Pixel count
-        int32_t pl = 0;          // Pixel line length
-        uint16_t pcol = 0;       // Pixel color
-        bool     pf = true;      // Flag for plotting
-        while (pc < w) {
-          line = pgm_read_byte((uint8_t *)flash_address);
-          flash_address++;
-          if (line & 0x80) { pcol = textcolor; line &= 0x7F; pf = true;}
-          else { pcol = textbgcolor; if (textcolor == textbgcolor) pf = false;}
-          line++;
-          px = pc % width;
-          tx = x + textsize * px;
-          py = pc / width;
-          ty = y + textsize * py;
-
-          pl = 0;
-          pc += line;
-          while (line--) {
-            pl++;
-            if ((px+pl) >= width) {
-              if (pf) fillRect(tx, ty, pl * textsize, textsize, pcol);
-              pl = 0;
-              px = 0;
-              tx = x;
-              py ++;
-              ty += textsize;
-            }
-          }
-          if (pl && pf) fillRect(tx, ty, pl * textsize, textsize, pcol);
+          line++; w -= line;
+          while (line--) writeColor(bgcolor);
         }
       }
     }
+    else drawRleRuns((const uint8_t *)flash_address, width, height, x, y, textcolor, textbgcolor, textsize);
   }
   // End of RLE font rendering
 #endif
@@ -2476,12 +3768,25 @@ void TFT_eSprite::drawGlyph(uint16_t code)
     }
 
     uint8_t* pbuffer = nullptr;
-    const uint8_t* gPtr = (const uint8_t*) gFont.gArray;
+    const uint8_t* gPtr = (const uint8_t*) gFont.gArray + gBitmap[gNum];
+
+    // Copy the glyph from the atlas unless it overlaps the previous glyph background
+    const uint16_t* aPtr = nullptr;
+    bool inkIsBg = false;
+    if (gaBudget && !getBG && (_bpp == 16 || _bpp == 8) && !(_fillbg && bg_cursor_x > cursor_x + gdX[gNum]))
+    {
+      aPtr = atlasGlyph(gNum, fg, bg, &inkIsBg);
+      // bg is the transparent colour when the background is not filled
+      if (inkIsBg && !_fillbg) aPtr = nullptr;
+    }
 
 #ifdef FONT_FS_AVAILABLE
-    if (fs_font) {
-      fontFile.seek(gBitmap[gNum], fs::SeekSet); // This is slow for a significant position shift!
-      pbuffer =  (uint8_t*)malloc(gWidth[gNum]);
+    if (fs_font && !aPtr) {
+      gPtr = cachedGlyph(gNum);
+      if (!gPtr) {
+        fontFile.seek(gBitmap[gNum], fs::SeekSet); // This is slow for a significant position shift!
+        pbuffer =  (uint8_t*)malloc(gWidth[gNum]);
+      }
     }
 #endif
 
@@ -2525,54 +3830,85 @@ void TFT_eSprite::drawGlyph(uint16_t code)
       }
     }
 
-    for (int32_t y = 0; y < gHeight[gNum]; y++)
+    if (aPtr)
     {
-#ifdef FONT_FS_AVAILABLE
-      if (fs_font) {
-        fontFile.read(pbuffer, gWidth[gNum]);
+      bool    swap   = _swapBytes;
+      uint8_t dither = _dither;
+      _swapBytes = false; // Atlas images are already byte swapped
+      _dither    = 0;     // Glyphs keep the exact text colours
+      if (_fillbg) pushImage(cx, cy, gWidth[gNum], gHeight[gNum], (uint16_t*)aPtr);
+      else
+      {
+        // Copy runs of glyph pixels, bg pixels are transparent
+        uint16_t key = bg << 8 | bg >> 8;
+        const uint16_t* row = aPtr;
+        for (int32_t y = 0; y < gHeight[gNum]; y++)
+        {
+          int32_t x = 0;
+          while (x < gWidth[gNum])
+          {
+            while (x < gWidth[gNum] && row[x] == key) x++;
+            int32_t xs = x;
+            while (x < gWidth[gNum] && row[x] != key) x++;
+            if (x > xs) pushImage(cx + xs, cy + y, x - xs, 1, (uint16_t*)row + xs);
+          }
+          row += gWidth[gNum];
+        }
       }
-#endif
-
-      for (int32_t x = 0; x < gWidth[gNum]; x++)
+      _swapBytes = swap;
+      _dither    = dither;
+    }
+    else
+    {
+      for (int32_t y = 0; y < gHeight[gNum]; y++)
       {
 #ifdef FONT_FS_AVAILABLE
-        if (fs_font) pixel = pbuffer[x];
-        else
+        if (pbuffer) {
+          fontFile.read(pbuffer, gWidth[gNum]);
+        }
 #endif
-        pixel = pgm_read_byte(gPtr + gBitmap[gNum] + x + gWidth[gNum] * y);
 
-        if (pixel)
+        for (int32_t x = 0; x < gWidth[gNum]; x++)
         {
-          if (bl) { drawFastHLine( bxs, y + cy, bl, bg); bl = 0; }
-          if (pixel != 0xFF)
+#ifdef FONT_FS_AVAILABLE
+          if (pbuffer) pixel = pbuffer[x];
+          else
+#endif
+          pixel = pgm_read_byte(gPtr + x + gWidth[gNum] * y);
+
+          if (pixel)
           {
-            if (fl) {
-              if (fl==1) drawPixel(fxs, y + cy, fg);
-              else drawFastHLine( fxs, y + cy, fl, fg);
-              fl = 0;
+            if (bl) { drawFastHLine( bxs, y + cy, bl, bg); bl = 0; }
+            if (pixel != 0xFF)
+            {
+              if (fl) {
+                if (fl==1) drawPixel(fxs, y + cy, fg);
+                else drawFastHLine( fxs, y + cy, fl, fg);
+                fl = 0;
+              }
+              if (getBG) bg = readPixel(x + cx, y + cy);
+              drawPixel(x + cx, y + cy, alphaBlend(pixel, fg, bg));
+            }
+            else
+            {
+              if (fl==0) fxs = x + cx;
+              fl++;
             }
-            if (getBG) bg = readPixel(x + cx, y + cy);
-            drawPixel(x + cx, y + cy, alphaBlend(pixel, fg, bg));
           }
           else
           {
-            if (fl==0) fxs = x + cx;
-            fl++;
-          }
-        }
-        else
-        {
-          if (fl) { drawFastHLine( fxs, y + cy, fl, fg); fl = 0; }
-          if (_fillbg) {
-            if (x >= bx) {
-              if (bl==0) bxs = x + cx;
-              bl++;
+            if (fl) { drawFastHLine( fxs, y + cy, fl, fg); fl = 0; }
+            if (_fillbg) {
+              if (x >= bx) {
+                if (bl==0) bxs = x + cx;
+                bl++;
+              }
             }
           }
         }
+        if (fl) { drawFastHLine( fxs, y + cy, fl, fg); fl = 0; }
+        if (bl) { drawFastHLine( bxs, y + cy, bl, bg); bl = 0; }
       }
-      if (fl) { drawFastHLine( fxs, y + cy, fl, fg); fl = 0; }
-      if (bl) { drawFastHLine( bxs, y + cy, bl, bg); bl = 0; }
     }
 
     // Fill area below glyph
@@ -5,7 +5,28 @@
 // graphics are written to the Sprite rather than the TFT.
 ***************************************************************************************/
 
-class TFT_eSprite : public TFT_eSPI {
+// Maximum number of dirty rectangles recorded, when full the nearest are merged
+#ifndef SPRITE_DIRTY_RECTS
+  #define SPRITE_DIRTY_RECTS 8
+#endif
+
+// Rectangles are merged if this or fewer extra pixels would then be pushed
+#ifndef SPRITE_DIRTY_SLACK
+  #define SPRITE_DIRTY_SLACK 64
+#endif
+
+// pushDiff() merges changed runs in a line separated by fewer unchanged pixels than this
+#ifndef SPRITE_DIFF_GAP
+  #define SPRITE_DIFF_GAP 6
+#endif
+
+// pushDiff() sends the whole Sprite if this percentage or more of the pixels have changed
+#ifndef SPRITE_DIFF_FULL
+  #define SPRITE_DIFF_FULL 80
+#endif
+
+class TFT_eSprite : public TFT_eSPI { friend class TFT_eSPI_Q565;   // Q565 decodes into Sprite memory
+                                      friend class TFT_eSPI_Mesh3D; // Mesh3D renders into Sprite memory
 
  public:
 
@@ -17,10 +38,14 @@ class TFT_eSprite : public TFT_eSPI {
            // RAM required is:
            //  - 1 bit per pixel for 1 bit colour depth
            //  - 1 nibble per pixel for 4-bit colour (with palette table)
-           //  - 1 byte per pixel for 8-bit colour (332 RGB format)
+           //  - 1 byte per pixel for 8-bit colour (332 RGB format, or palette index after createPalette())
            //  - 2 bytes per pixel for 16-bit color depth (565 RGB format)
   void*    createSprite(int16_t width, int16_t height, uint8_t frames = 1);
 
+           // Take the memory for this Sprite (and its palette and alpha plane) from a pool instead of
+           // the heap, nullptr returns to the heap. Returns false if the Sprite is already created
+  bool     setPool(TFT_eSPI_SpritePool *pool);
+
            // Returns a pointer to the sprite or nullptr if not created, user must cast to pointer type
   void*    getPointer(void);
 
@@ -33,6 +58,8 @@ class TFT_eSprite : public TFT_eSPI {
            // Select the frame buffer for graphics write (for 2 colour ePaper and DMA toggle buffer)
            // Returns a pointer to the Sprite frame buffer
   void*    frameBuffer(int8_t f);
+           // Returns a pointer to the frame selected for graphics, e.g. after pushSpriteDMA() has flipped it
+  void*    getFramePointer(void);
   
            // Set or get the colour depth to 1, 4, 8 or 16 bits. Can be used to change depth an existing
            // sprite, but clears it to black, returns a new pointer if sprite is re-created.
@@ -40,8 +67,12 @@ class TFT_eSprite : public TFT_eSPI {
   int8_t   getColorDepth(void);
 
            // Set the palette for a 4-bit depth sprite.  Only the first 16 colours in the map are used.
-  void     createPalette(uint16_t *palette = nullptr, uint8_t colors = 16);       // Palette in RAM
-  void     createPalette(const uint16_t *palette = nullptr, uint8_t colors = 16); // Palette in FLASH
+           // For an 8-bit sprite up to 256 colours replace RGB332, with a default (nullptr) palette of
+           // the RGB332 colours. Colours drawn are mapped to the nearest palette colour with a 4096 entry
+           // table (RGB444, 4.5 kbytes with the palette), so palette colours that differ by less than 16
+           // in every 8-bit channel may share an index. colors = 0 uses the whole palette (16 or 256).
+  void     createPalette(uint16_t *palette = nullptr, uint16_t colors = 0);       // Palette in RAM
+  void     createPalette(const uint16_t *palette = nullptr, uint16_t colors = 0); // Palette in FLASH
 
            // Set a single palette index to the given color
   void     setPaletteColor(uint8_t index, uint16_t color);
@@ -49,6 +80,14 @@ class TFT_eSprite : public TFT_eSPI {
            // Get the color at the given palette index
   uint16_t getPaletteColor(uint8_t index);
 
+           // Free an 8-bit sprite palette, RGB332 colours are then used again (pixels are not changed)
+  void     deletePalette(void);
+
+           // Ordered (4x4 Bayer) dither of 16-bit images pushed into an 8-bit sprite with a palette.
+           // spread is the step between palette colours in 8-bit channel units, e.g. 51 for 6 levels
+           // per channel, 0 turns dithering off. Graphics and text colours are not dithered.
+  void     setDither(uint8_t spread);
+
            // Set foreground and background colours for 1 bit per pixel Sprite
   void     setBitmapColor(uint16_t fg, uint16_t bg);
 
@@ -93,10 +132,12 @@ class TFT_eSprite : public TFT_eSPI {
   void     setRotation(uint8_t rotation);
   uint8_t  getRotation(void);
 
-           // Push a rotated copy of Sprite to TFT with optional transparent colour
-  bool     pushRotated(int16_t angle, uint32_t transp = 0x00FFFFFF);
+           // Push a rotated copy of Sprite to TFT with optional transparent colour, set smooth true
+           // to bilinear filter (anti-alias) the rotated image
+  bool     pushRotated(int16_t angle, uint32_t transp = 0x00FFFFFF, bool smooth = false);
            // Push a rotated copy of Sprite to another different Sprite with optional transparent colour
-  bool     pushRotated(TFT_eSprite *spr, int16_t angle, uint32_t transp = 0x00FFFFFF);
+           // 4bpp and 1bpp destination Sprites need a source Sprite of the same colour depth
+  bool     pushRotated(TFT_eSprite *spr, int16_t angle, uint32_t transp = 0x00FFFFFF, bool smooth = false);
 
            // Get the TFT bounding box for a rotated copy of this Sprite
   bool     getRotatedBounds(int16_t angle, int16_t *min_x, int16_t *min_y, int16_t *max_x, int16_t *max_y);
@@ -114,6 +155,10 @@ class TFT_eSprite : public TFT_eSPI {
            // 16bpp = colour, 8bpp = byte, 4bpp = colour index, 1bpp = 1 or 0
   uint16_t readPixelValue(int32_t x, int32_t y);
 
+           // Read or write a line of n 565 colours (not byte swapped) at x,y, clipped to the viewport
+  void     readSpan(int32_t x, int32_t y, int32_t n, uint16_t *data);
+  void     writeSpan(int32_t x, int32_t y, int32_t n, uint16_t *data);
+
            // Write an image (colour bitmap) to the sprite.
   void     pushImage(int32_t x0, int32_t y0, int32_t w, int32_t h, uint16_t *data, uint8_t sbpp = 0);
   void     pushImage(int32_t x0, int32_t y0, int32_t w, int32_t h, const uint16_t *data);
@@ -126,10 +171,55 @@ class TFT_eSprite : public TFT_eSPI {
            // Push a windowed area of the sprite to the TFT at tx, ty
   bool     pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
 
+           // Send a 16bpp Sprite with DMA (call tft.initDMA() before createSprite() and tft.startWrite()
+           // before pushing), returns while the transfer runs. A Sprite created with 2 frames then
+           // draws to the other frame so the next image is drawn while this one is sent
+  bool     pushSpriteDMA(int32_t x, int32_t y);
+
+           // Dirty rectangle tracking, when enabled the Sprite areas changed by graphics functions are
+           // recorded so that pushDirty() only sends those areas to the TFT. Overlapping and nearby
+           // areas are merged, up to SPRITE_DIRTY_RECTS rectangles are held. All colour depths are
+           // tracked, a rotated 1bpp Sprite is sent whole by pushDirty() if anything has changed.
+  void     setDirtyTracking(bool enable);
+  bool     getDirtyTracking(void);
+           // Mark an area as changed, e.g. after the Sprite memory has been written via getPointer()
+  void     markDirty(int32_t x, int32_t y, int32_t w, int32_t h);
+           // Discard the recorded areas
+  void     clearDirty(void);
+           // Return the number of dirty rectangles currently recorded
+  uint8_t  getDirtyCount(void);
+           // Get the box enclosing all the dirty rectangles (Sprite memory coordinates), false if none
+  bool     getDirtyBounds(int32_t *x, int32_t *y, int32_t *w, int32_t *h);
+           // Push the changed areas to the TFT with the Sprite top left corner at x,y, then clear the
+           // record. Set dma true to use DMA (16bpp only, call tft.startWrite() first as for pushImageDMA)
+  bool     pushDirty(int32_t x, int32_t y, bool dma = false);
+
+           // For a Sprite created with 2 frames: push only the pixels of the current frame that differ
+           // from the other frame, then update the other frame to match. The other frame must hold the
+           // image last sent to the TFT at x,y (e.g. use pushDiff() for every update of that area).
+           // Changed runs are combined into as few TFT windows as practical, the whole Sprite is sent
+           // if most of it has changed. Single frame and 4bpp Sprites are always sent in full.
+  bool     pushDiff(int32_t x, int32_t y);
+
            // Push the sprite to another sprite at x,y. This fn calls pushImage() in the destination sprite (dspr) class.
   bool     pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y);
   bool     pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y, uint16_t transparent);
 
+           // Per-pixel alpha for 16bpp Sprites. createAlpha() adds an 8-bit opacity plane (0 = transparent,
+           // 255 = opaque) with all pixels set to alpha, it is freed by deleteAlpha() or deleteSprite().
+           // The graphics functions only draw to the colour plane, the alpha plane is set separately.
+           // pushToSprite() then blends the Sprite into 16bpp and 8bpp destination Sprites.
+  uint8_t* createAlpha(uint8_t alpha = 255);
+  void     deleteAlpha(void);
+  uint8_t* getAlphaPointer(void);
+  void     fillAlpha(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t alpha);
+           // Copy a w x h 8-bit alpha mask (e.g. anti-aliased icon coverage) into the plane at x,y
+  void     setAlphaMask(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *mask);
+  uint8_t  readAlpha(int32_t x, int32_t y);
+           // Push to the TFT at x,y skipping alpha 0 pixels and blending others with colour bg, which
+           // should match the screen behind the Sprite
+  bool     pushBlended(int32_t x, int32_t y, uint16_t bg);
+
            // Draw a single character in the selected font
   int16_t  drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font),
            drawChar(uint16_t uniCode, int32_t x, int32_t y);
@@ -154,6 +244,39 @@ class TFT_eSprite : public TFT_eSPI {
 
            // Reserve memory for the Sprite and return a pointer
   void*    callocSprite(int16_t width, int16_t height, uint8_t frames = 1);
+           // Zeroed memory from the pool or heap (PSRAM allowed if psram is true), and free it
+  void*    spriteAlloc(uint32_t bytes, bool psram);
+  void     spriteFree(void *ptr);
+
+  typedef struct { int16_t x0, y0, x1, y1; } dirtyRect_t; // Inclusive corners in Sprite memory frame
+
+           // Record a changed area of Sprite memory, corners are inclusive and include datum offsets
+  void     dirtyArea(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+  int32_t  dirtyWaste(const dirtyRect_t *r, int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+           // 8-bit pixel value of a 565 colour (RGB332 or the nearest palette index) and back
+  uint8_t  color8(uint16_t color);
+  uint16_t color16(uint8_t value);
+           // Palette index of a 565 colour with the ordered dither offset for Sprite pixel x,y
+  uint8_t  ditherColor8(uint16_t color, int32_t x, int32_t y);
+           // Set the 8-bit palette index table entries, all or those affected by a new colour at index
+  void     indexPalette(int16_t index = -1);
+           // Rotated Sprite pixel fetch helpers, xs,ys are fixed point source coordinates
+  uint16_t rotatedPixel(int32_t x, int32_t y);
+  void     rotatedLine(uint16_t *buf, int32_t xs, int32_t ys, int32_t n);
+  uint16_t rotatedBilinear(int32_t xs, int32_t ys, uint32_t transp, uint16_t bg);
+  void     rotatedSmooth(uint16_t *buf, int32_t xs, int32_t ys, int32_t n, uint32_t transp,
+                         uint16_t tpcolor, TFT_eSprite *dspr, int32_t x, int32_t y);
+
+           // Convert 1bpp Sprite corner coordinates to the (unrotated) memory frame
+  void     memoryArea(int32_t *x0, int32_t *y0, int32_t *x1, int32_t *y1);
+           // Fill a 1bpp Sprite area, corners are inclusive and include datum offsets
+  void     fillArea1(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+
+           // Blend this Sprite into dspr using the alpha plane
+  bool     blendToSprite(TFT_eSprite *dspr, int32_t x, int32_t y);
+
+           // Push an area of Sprite memory sx,sy,sw,sh to the TFT at tx,ty
+  void     pushArea(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh, bool dma);
 
            // Override the non-inlined TFT_eSPI functions
   void     begin_nin_write(void) { ; }
@@ -168,7 +291,13 @@ class TFT_eSprite : public TFT_eSPI {
   uint8_t  *_img8_1; // pointer to frame 1
   uint8_t  *_img8_2; // pointer to frame 2
 
-  uint16_t *_colorMap; // color map pointer: 16 entries, used with 4-bit color map.
+  uint16_t *_colorMap; // color map pointer: 16 entries, used with 4-bit color map, 256 for 8-bit
+  uint8_t  *_colorIndex; // 8-bit palette index of each RGB444 colour, or nullptr for RGB332
+  uint16_t _paletteSize; // Number of 8-bit palette colours in use
+  uint8_t  _dither;      // Ordered dither spread for 8-bit palette images, 0 = off
+  uint8_t  *_alpha;    // 8-bit alpha plane pointer for 16-bit Sprites, or nullptr
+
+  TFT_eSPI_SpritePool *_pool; // Memory pool for the Sprite, or nullptr for the heap
 
   int32_t  _sinra;   // Sine of rotation angle in fixed point
   int32_t  _cosra;   // Cosine of rotation angle in fixed point
@@ -185,4 +314,8 @@ class TFT_eSprite : public TFT_eSPI {
   int32_t  _dwidth, _dheight; // Real sprite width and height (for <8bpp Sprites)
   int32_t  _bitwidth;         // Sprite image bit width for drawPixel (for <8bpp Sprites, not swapped)
 
+  bool     _dirtyTrack;  // Record changed areas for pushDirty()
+  uint8_t  _dirtyCount;  // Number of dirty rectangles in use
+  dirtyRect_t _dirty[SPRITE_DIRTY_RECTS];
+
 };
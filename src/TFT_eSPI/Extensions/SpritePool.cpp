@@ -0,0 +1,240 @@
+/***************************************************************************************
+** Code for the Sprite memory pool
+** Each size class is a run of equal blocks, a block is found by scanning the block
+** records of the smallest class with a free block that is large enough.
+***************************************************************************************/
+#if defined (ESP32)
+  #include "esp_heap_caps.h"
+#endif
+
+TFT_eSPI_SpritePool::TFT_eSPI_SpritePool(void) {
+  _classes   = 0;
+  _mem       = nullptr;
+  _request   = nullptr;
+  _size      = 0;
+  _blocks    = 0;
+  _owned     = false;
+  _used      = 0;
+  _requested = 0;
+  _highWater = 0;
+  _failures  = 0;
+}
+
+TFT_eSPI_SpritePool::~TFT_eSPI_SpritePool(void) {
+  end();
+}
+
+bool TFT_eSPI_SpritePool::addClass(uint32_t size, uint16_t count)
+{
+  if (_mem || size == 0 || count == 0) return false;
+  if ((uint32_t)_blocks + count > 0xFFFF) return false;
+
+  size = (size + 3) & ~3UL;
+
+  // Keep the classes in size order, a class of the same size gets more blocks
+  uint8_t c = 0;
+  while (c < _classes && _class[c].size < size) c++;
+  if (c < _classes && _class[c].size == size) _class[c].count += count;
+  else
+  {
+    if (_classes == SPRITE_POOL_CLASSES) return false;
+    for (uint8_t i = _classes; i > c; i--) _class[i] = _class[i - 1];
+    _class[c].size  = size;
+    _class[c].count = count;
+    _classes++;
+  }
+
+  _blocks += count;
+
+  return true;
+}
+
+uint32_t TFT_eSPI_SpritePool::memoryNeeded(void)
+{
+  uint32_t bytes = 0;
+  for (uint8_t c = 0; c < _classes; c++) bytes += _class[c].size * _class[c].count;
+  return bytes + _blocks * sizeof(uint32_t);
+}
+
+bool TFT_eSPI_SpritePool::begin(uint8_t placement)
+{
+  if (_mem || _classes == 0) return false;
+
+  uint32_t bytes = memoryNeeded();
+  void *mem = nullptr;
+
+#if defined (ESP32)
+  if (placement == SPRITE_POOL_DEFAULT)
+  {
+  #if defined (CONFIG_SPIRAM_SUPPORT)
+    placement = psramFound() ? SPRITE_POOL_PSRAM : SPRITE_POOL_INTERNAL;
+  #else
+    placement = SPRITE_POOL_INTERNAL;
+  #endif
+  }
+  if      (placement == SPRITE_POOL_PSRAM) mem = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  else if (placement == SPRITE_POOL_DMA)   mem = heap_caps_malloc(bytes, MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+  else                                     mem = heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#else
+  // Other processors have one kind of RAM
+  if (placement != SPRITE_POOL_PSRAM) mem = malloc(bytes);
+#endif
+
+  if (mem == nullptr) return false;
+
+  if (!begin(mem, bytes)) { ::free(mem); return false; }
+  _owned = true;
+
+  return true;
+}
+
+bool TFT_eSPI_SpritePool::begin(void *buffer, uint32_t len)
+{
+  if (_mem || _classes == 0 || buffer == nullptr) return false;
+
+  // Blocks must be 32-bit aligned
+  uint8_t *mem = (uint8_t *)buffer;
+  uint8_t  pad = (4 - ((uintptr_t)mem & 3)) & 3;
+  if (len < pad || len - pad < memoryNeeded()) return false;
+  mem += pad;
+
+  _size = 0;
+  uint16_t first = 0;
+  for (uint8_t c = 0; c < _classes; c++)
+  {
+    _class[c].offset = _size;
+    _class[c].first  = first;
+    _class[c].inUse  = 0;
+    _class[c].peak   = 0;
+    _size += _class[c].size * _class[c].count;
+    first += _class[c].count;
+  }
+
+  _mem     = mem;
+  _request = (uint32_t *)(mem + _size);
+  memset(_request, 0, _blocks * sizeof(uint32_t));
+  _owned   = false;
+  _used    = 0;
+  _requested = 0;
+  resetStats();
+
+  return true;
+}
+
+void TFT_eSPI_SpritePool::end(void)
+{
+  if (_owned) ::free(_mem);
+  _mem     = nullptr;
+  _request = nullptr;
+  _owned   = false;
+}
+
+void* TFT_eSPI_SpritePool::alloc(uint32_t size)
+{
+  if (_mem == nullptr || size == 0) return nullptr;
+
+  for (uint8_t c = 0; c < _classes; c++)
+  {
+    poolClass_t *pc = _class + c;
+    if (pc->size < size || pc->inUse == pc->count) continue;
+
+    for (uint16_t b = 0; b < pc->count; b++)
+    {
+      if (_request[pc->first + b]) continue;
+
+      _request[pc->first + b] = size;
+      if (++pc->inUse > pc->peak) pc->peak = pc->inUse;
+      _used      += pc->size;
+      _requested += size;
+      if (_used > _highWater) _highWater = _used;
+
+      uint8_t *ptr = _mem + pc->offset + b * pc->size;
+      memset(ptr, 0, size);
+      return ptr;
+    }
+  }
+
+  _failures++;
+  return nullptr;
+}
+
+void TFT_eSPI_SpritePool::free(void *ptr)
+{
+  if (!owns(ptr)) return;
+
+  uint32_t offset = (uint8_t *)ptr - _mem;
+  uint8_t c = _classes - 1;
+  while (c && _class[c].offset > offset) c--;
+
+  poolClass_t *pc = _class + c;
+  uint16_t b = (offset - pc->offset) / pc->size;
+
+  // Ignore pointers that are not to the start of a block in use
+  if (pc->offset + b * pc->size != offset || _request[pc->first + b] == 0) return;
+
+  _requested -= _request[pc->first + b];
+  _request[pc->first + b] = 0;
+  _used -= pc->size;
+  pc->inUse--;
+}
+
+bool TFT_eSPI_SpritePool::owns(const void *ptr)
+{
+  return _mem && ((const uint8_t *)ptr >= _mem) && ((const uint8_t *)ptr < _mem + _size);
+}
+
+uint32_t TFT_eSPI_SpritePool::size(void)
+{
+  return _mem ? _size : 0;
+}
+
+uint32_t TFT_eSPI_SpritePool::used(void)
+{
+  return _used;
+}
+
+uint32_t TFT_eSPI_SpritePool::highWater(void)
+{
+  return _highWater;
+}
+
+uint32_t TFT_eSPI_SpritePool::wasted(void)
+{
+  return _used - _requested;
+}
+
+uint32_t TFT_eSPI_SpritePool::largestFree(void)
+{
+  if (_mem == nullptr) return 0;
+
+  for (uint8_t c = _classes; c--; )
+  {
+    if (_class[c].inUse < _class[c].count) return _class[c].size;
+  }
+
+  return 0;
+}
+
+uint16_t TFT_eSPI_SpritePool::failures(void)
+{
+  return _failures;
+}
+
+bool TFT_eSPI_SpritePool::classStats(uint8_t c, uint32_t *size, uint16_t *inUse, uint16_t *freeBlocks, uint16_t *highWater)
+{
+  if (c >= _classes) return false;
+
+  if (size)       *size       = _class[c].size;
+  if (inUse)      *inUse      = _class[c].inUse;
+  if (freeBlocks) *freeBlocks = _class[c].count - _class[c].inUse;
+  if (highWater)  *highWater  = _class[c].peak;
+
+  return true;
+}
+
+void TFT_eSPI_SpritePool::resetStats(void)
+{
+  _highWater = _used;
+  _failures  = 0;
+  for (uint8_t c = 0; c < _classes; c++) _class[c].peak = _class[c].inUse;
+}
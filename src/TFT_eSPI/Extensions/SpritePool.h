@@ -0,0 +1,77 @@
+/***************************************************************************************
+// Sprite memory pool. One block of memory is reserved at startup and divided into size
+// classes of equal blocks, e.g. one full screen frame, a few widget Sprites and many
+// small icons and palettes. Sprites bound with setPool() take their memory from the
+// smallest free block that fits, so creating and deleting Sprites never fragments the
+// heap and the time to allocate is bounded by the number of blocks.
+***************************************************************************************/
+
+// Maximum number of size classes
+#ifndef SPRITE_POOL_CLASSES
+  #define SPRITE_POOL_CLASSES 8
+#endif
+
+// Memory placement for begin()
+#define SPRITE_POOL_DEFAULT  0 // PSRAM if found, else internal RAM
+#define SPRITE_POOL_INTERNAL 1 // Internal RAM
+#define SPRITE_POOL_PSRAM    2 // PSRAM (ESP32), fails if there is none
+#define SPRITE_POOL_DMA      3 // Internal DMA capable RAM (ESP32), e.g. for pushSpriteDMA()
+
+class TFT_eSPI_SpritePool
+{
+ public:
+  TFT_eSPI_SpritePool(void);
+  ~TFT_eSPI_SpritePool(void);
+
+  // Add count blocks of size bytes, call before begin(). Sizes are rounded up to 4 bytes
+  bool     addClass(uint32_t size, uint16_t count);
+  // Bytes needed for the blocks added so far and the block records (4 bytes per block)
+  uint32_t memoryNeeded(void);
+
+  // Reserve the memory for all the classes, returns false if there is not enough
+  bool     begin(uint8_t placement = SPRITE_POOL_DEFAULT);
+  // Use a buffer of at least memoryNeeded() bytes instead, e.g. a static array
+  bool     begin(void *buffer, uint32_t len);
+  // Free the memory, all the Sprites using the pool must be deleted first
+  void     end(void);
+
+  // Return a zeroed block of at least size bytes, or nullptr if none is free
+  void*    alloc(uint32_t size);
+  // Return a block to the pool, pointers not from the pool are ignored
+  void     free(void *ptr);
+  // Returns true if ptr is in the pool memory
+  bool     owns(const void *ptr);
+
+  // Statistics, all in bytes. Blocks are never split so there is no external fragmentation,
+  // wasted() is the internal fragmentation: bytes in used blocks beyond the sizes requested
+  uint32_t size(void);        // Pool memory, excluding block records
+  uint32_t used(void);        // Bytes in blocks in use
+  uint32_t highWater(void);   // Most bytes in use at one time since begin() or resetStats()
+  uint32_t wasted(void);      // Unrequested bytes in blocks in use
+  uint32_t largestFree(void); // Largest free block, the largest Sprite that can be created now
+  uint16_t failures(void);    // Allocations that failed since begin() or resetStats()
+  // Blocks in use and free for a size class, classes are numbered smallest first
+  bool     classStats(uint8_t c, uint32_t *size, uint16_t *inUse, uint16_t *freeBlocks, uint16_t *highWater);
+  void     resetStats(void);
+
+ private:
+  typedef struct {
+    uint32_t size;      // Block size
+    uint32_t offset;    // Offset of the first block in the pool
+    uint16_t count;     // Number of blocks
+    uint16_t first;     // Index of the first block record
+    uint16_t inUse, peak;
+  } poolClass_t;
+
+  poolClass_t _class[SPRITE_POOL_CLASSES];
+  uint8_t     _classes;
+
+  uint8_t    *_mem;       // Pool memory, nullptr before begin()
+  uint32_t   *_request;   // Bytes requested for each block, 0 if free
+  uint32_t    _size;      // Bytes of blocks
+  uint16_t    _blocks;    // Total number of blocks
+  bool        _owned;     // Memory was allocated by begin()
+
+  uint32_t    _used, _requested, _highWater;
+  uint16_t    _failures;
+};
@@ -570,6 +570,88 @@ void TFT_eSPI::pushPixels(const void* data_in, uint32_t len){
 #if defined (ESP32_DMA) && !defined (TFT_PARALLEL_8_BIT) //       DMA FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////////////
 
+// DMA queue. Transactions are used in turn from a ring, window commands and pixel blocks
+// are queued back to back so the CPU only waits when the ring is full or a buffer that is
+// still being sent is about to be reused. Each pixel block records the memory it sends,
+// the post transfer callback marks the memory free.
+#define DMA_QUEUE_TRANS (DMA_QUEUE_SIZE * 6) // Window (5) and pixels (1) for each push
+
+typedef struct {
+  const uint8_t* start;
+  const uint8_t* end;
+  volatile bool  busy;
+} dmaBuffer_t;
+
+static spi_transaction_t dmaTrans[DMA_QUEUE_TRANS];
+static dmaBuffer_t       dmaBuffer[DMA_QUEUE_SIZE];
+static uint8_t           dmaTransNext  = 0;
+static uint8_t           dmaBufferNext = 0;
+
+// Transaction user value: bit 0 is the D/C line state, for pixel blocks the rest points to
+// the dmaBuffer_t entry
+#define DMA_USER_CMD  0
+#define DMA_USER_DATA 1
+
+/***************************************************************************************
+** Function name:           dmaReclaim
+** Description:             Collect one finished transaction, false if none
+***************************************************************************************/
+static bool dmaReclaim(uint8_t& busy, TickType_t wait)
+{
+  spi_transaction_t *rtrans;
+  if (!busy || spi_device_get_trans_result(dmaHAL, &rtrans, wait) != ESP_OK) return false;
+  busy--;
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           dmaQueue
+** Description:             Queue a transaction of len bytes
+***************************************************************************************/
+// Blocks of up to 4 bytes are copied into the transaction, so data may be on the stack
+static void dmaQueue(uint8_t& busy, const void* data, uint32_t len, uintptr_t user)
+{
+  // The oldest transaction in the ring must have been collected before it is reused
+  while (busy >= DMA_QUEUE_TRANS) dmaReclaim(busy, portMAX_DELAY);
+
+  spi_transaction_t *trans = dmaTrans + dmaTransNext;
+  if (++dmaTransNext >= DMA_QUEUE_TRANS) dmaTransNext = 0;
+
+  memset(trans, 0, sizeof(spi_transaction_t));
+
+  trans->user   = (void *)user;
+  trans->length = len * 8;   // Data length, in bits
+  if (len <= 4) {
+    trans->flags = SPI_TRANS_USE_TXDATA;
+    memcpy(trans->tx_data, data, len);
+  }
+  else trans->tx_buffer = data;
+
+  esp_err_t ret = spi_device_queue_trans(dmaHAL, trans, portMAX_DELAY);
+  assert(ret == ESP_OK);
+
+  busy++;
+}
+
+/***************************************************************************************
+** Function name:           dmaQueuePixels
+** Description:             Queue a block of pixels and record the memory in use
+***************************************************************************************/
+static void dmaQueuePixels(uint8_t& busy, const uint16_t* data, uint32_t len)
+{
+  dmaBuffer_t *buf = dmaBuffer + dmaBufferNext;
+  if (++dmaBufferNext >= DMA_QUEUE_SIZE) dmaBufferNext = 0;
+
+  // Entries are used in turn too, the oldest block must have been sent
+  while (buf->busy && dmaReclaim(busy, portMAX_DELAY));
+
+  buf->start = (const uint8_t*)data;
+  buf->end   = (const uint8_t*)(data + len);
+  buf->busy  = true;
+
+  dmaQueue(busy, data, len * 2, (uintptr_t)buf | DMA_USER_DATA);
+}
+
 /***************************************************************************************
 ** Function name:           dmaBusy
 ** Description:             Check if DMA is busy
@@ -578,14 +660,7 @@ bool TFT_eSPI::dmaBusy(void)
 {
   if (!DMA_Enabled || !spiBusyCheck) return false;
 
-  spi_transaction_t *rtrans;
-  esp_err_t ret;
-  uint8_t checks = spiBusyCheck;
-  for (int i = 0; i < checks; ++i)
-  {
-    ret = spi_device_get_trans_result(dmaHAL, &rtrans, 0);
-    if (ret == ESP_OK) spiBusyCheck--;
-  }
+  while (dmaReclaim(spiBusyCheck, 0));
 
   //Serial.print("spiBusyCheck=");Serial.println(spiBusyCheck);
   if (spiBusyCheck ==0) return false;
@@ -600,14 +675,66 @@ bool TFT_eSPI::dmaBusy(void)
 void TFT_eSPI::dmaWait(void)
 {
   if (!DMA_Enabled || !spiBusyCheck) return;
-  spi_transaction_t *rtrans;
-  esp_err_t ret;
-  for (int i = 0; i < spiBusyCheck; ++i)
-  {
-    ret = spi_device_get_trans_result(dmaHAL, &rtrans, portMAX_DELAY);
-    assert(ret == ESP_OK);
+
+  while (dmaReclaim(spiBusyCheck, portMAX_DELAY));
+}
+
+
+/***************************************************************************************
+** Function name:           dmaFence
+** Description:             Wait until len bytes at buffer are no longer being sent
+***************************************************************************************/
+// Only the transfers up to the last one using the buffer are waited for
+void TFT_eSPI::dmaFence(const void* buffer, uint32_t len)
+{
+  if (!DMA_Enabled || !spiBusyCheck) return;
+
+  const uint8_t *start = (const uint8_t*)buffer;
+  const uint8_t *end   = start + (len ? len : 1);
+
+  for (uint8_t i = 0; i < DMA_QUEUE_SIZE; i++) {
+    dmaBuffer_t *buf = dmaBuffer + i;
+    while (buf->busy && (buf->start < end) && (buf->end > start) && dmaReclaim(spiBusyCheck, portMAX_DELAY));
   }
-  spiBusyCheck = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           setAddrWindowDMA
+** Description:             Queue the window commands for pushPixelsDMA()
+***************************************************************************************/
+// The commands follow any transfers still queued, so there is no wait for them to end
+void TFT_eSPI::setAddrWindowDMA(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  if (!DMA_Enabled) return;
+
+#if defined (ILI9225_DRIVER) || defined (SSD1351_DRIVER) || defined (SSD1963_DRIVER) || defined (RPI_DISPLAY_TYPE)
+  // Window commands differ from the usual CASET, PASET and RAMWR sequence
+  dmaWait();
+  setAddrWindow(x, y, w, h);
+#else
+  addr_row = 0xFFFF;
+  addr_col = 0xFFFF;
+
+  int32_t x1 = x + w - 1, y1 = y + h - 1;
+
+  #ifdef CGRAM_OFFSET
+    x  += colstart;
+    x1 += colstart;
+    y  += rowstart;
+    y1 += rowstart;
+  #endif
+
+  uint8_t caset = TFT_CASET, paset = TFT_PASET, ramwr = TFT_RAMWR;
+  uint8_t xa[4] = { (uint8_t)(x >> 8), (uint8_t)x, (uint8_t)(x1 >> 8), (uint8_t)x1 };
+  uint8_t ya[4] = { (uint8_t)(y >> 8), (uint8_t)y, (uint8_t)(y1 >> 8), (uint8_t)y1 };
+
+  dmaQueue(spiBusyCheck, &caset, 1, DMA_USER_CMD);
+  dmaQueue(spiBusyCheck, xa,     4, DMA_USER_DATA);
+  dmaQueue(spiBusyCheck, &paset, 1, DMA_USER_CMD);
+  dmaQueue(spiBusyCheck, ya,     4, DMA_USER_DATA);
+  dmaQueue(spiBusyCheck, &ramwr, 1, DMA_USER_CMD);
+#endif
 }
 
 
@@ -620,26 +747,12 @@ void TFT_eSPI::pushPixelsDMA(uint16_t* image, uint32_t len)
 {
   if ((len == 0) || (!DMA_Enabled)) return;
 
-  dmaWait();
-
   if(_swapBytes) {
+    dmaFence(image, len * 2); // Image may still be being sent from an earlier call
     for (uint32_t i = 0; i < len; i++) (image[i] = image[i] << 8 | image[i] >> 8);
   }
 
-  esp_err_t ret;
-  static spi_transaction_t trans;
-
-  memset(&trans, 0, sizeof(spi_transaction_t));
-
-  trans.user = (void *)1;
-  trans.tx_buffer = image;  //finally send the line data
-  trans.length = len * 16;        //Data length, in bits
-  trans.flags = 0;                //SPI_TRANS_USE_TXDATA flag
-
-  ret = spi_device_queue_trans(dmaHAL, &trans, portMAX_DELAY);
-  assert(ret == ESP_OK);
-
-  spiBusyCheck++;
+  dmaQueuePixels(spiBusyCheck, image, len);
 }
 
 
@@ -654,24 +767,9 @@ void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t
 
   uint32_t len = w*h;
 
-  dmaWait();
-
-  setAddrWindow(x, y, w, h);
-
-  esp_err_t ret;
-  static spi_transaction_t trans;
-
-  memset(&trans, 0, sizeof(spi_transaction_t));
+  setAddrWindowDMA(x, y, w, h);
 
-  trans.user = (void *)1;
-  trans.tx_buffer = image;   //Data pointer
-  trans.length = len * 16;   //Data length, in bits
-  trans.flags = 0;           //SPI_TRANS_USE_TXDATA flag
-
-  ret = spi_device_queue_trans(dmaHAL, &trans, portMAX_DELAY);
-  assert(ret == ESP_OK);
-
-  spiBusyCheck++;
+  dmaQueuePixels(spiBusyCheck, image, len);
 }
 
 
@@ -699,10 +797,10 @@ void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t
 
   uint32_t len = dw*dh;
 
-  if (buffer == nullptr) {
-    buffer = image;
-    dmaWait();
-  }
+  if (buffer == nullptr) buffer = image;
+
+  // The buffer is only waited for if it is about to be changed
+  if ( (dw != w) || (dh != h) || buffer != image || _swapBytes) dmaFence(buffer, len * 2);
 
   // If image is clipped, copy pixels into a contiguous block
   if ( (dw != w) || (dh != h) ) {
@@ -730,24 +828,9 @@ void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t
     }
   }
 
-  if (spiBusyCheck) dmaWait(); // In case we did not wait earlier
-
-  setAddrWindow(x, y, dw, dh);
+  setAddrWindowDMA(x, y, dw, dh);
 
-  esp_err_t ret;
-  static spi_transaction_t trans;
-
-  memset(&trans, 0, sizeof(spi_transaction_t));
-
-  trans.user = (void *)1;
-  trans.tx_buffer = buffer;  //finally send the line data
-  trans.length = len * 16;   //Data length, in bits
-  trans.flags = 0;           //SPI_TRANS_USE_TXDATA flag
-
-  ret = spi_device_queue_trans(dmaHAL, &trans, portMAX_DELAY);
-  assert(ret == ESP_OK);
-
-  spiBusyCheck++;
+  dmaQueuePixels(spiBusyCheck, buffer, len);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////
@@ -763,19 +846,25 @@ extern "C" void dc_callback();
 
 void IRAM_ATTR dc_callback(spi_transaction_t *spi_tx)
 {
-  if ((bool)spi_tx->user) {DC_D;}
+  if ((uintptr_t)spi_tx->user & DMA_USER_DATA) {DC_D;}
   else {DC_C;}
 }
 
 /***************************************************************************************
 ** Function name:           dma_end_callback
-** Description:             Clear DMA run flag to stop retransmission loop
+** Description:             Release the pixel memory sent and clear DMA run flag
 ***************************************************************************************/
 extern "C" void dma_end_callback();
 
 void IRAM_ATTR dma_end_callback(spi_transaction_t *spi_tx)
 {
+  uintptr_t user = (uintptr_t)spi_tx->user;
+  if (user > DMA_USER_DATA) ((dmaBuffer_t*)(user & ~(uintptr_t)DMA_USER_DATA))->busy = false;
+
+#ifndef CONFIG_IDF_TARGET_ESP32
+  // Stop retransmission loop
   WRITE_PERI_REG(SPI_DMA_CONF_REG(spi_host), 0);
+#endif
 }
 
 /***************************************************************************************
@@ -819,13 +908,9 @@ bool TFT_eSPI::initDMA(bool ctrl_cs)
     .input_delay_ns = 0,
     .spics_io_num = pin,
     .flags = SPI_DEVICE_NO_DUMMY, //0,
-    .queue_size = 1,
-    .pre_cb = 0, //dc_callback, //Callback to handle D/C line
-    #ifdef CONFIG_IDF_TARGET_ESP32
-      .post_cb = 0
-    #else
-      .post_cb = dma_end_callback
-    #endif
+    .queue_size = DMA_QUEUE_TRANS,
+    .pre_cb = dc_callback,      // Callback to handle D/C line
+    .post_cb = dma_end_callback // Callback to release buffers
   };
   ret = spi_bus_initialize(spi_host, &buscfg, DMA_CHANNEL);
   ESP_ERROR_CHECK(ret);
@@ -834,6 +919,9 @@ bool TFT_eSPI::initDMA(bool ctrl_cs)
 
   DMA_Enabled = true;
   spiBusyCheck = 0;
+  dmaTransNext = 0;
+  dmaBufferNext = 0;
+  for (uint8_t i = 0; i < DMA_QUEUE_SIZE; i++) dmaBuffer[i].busy = false;
   return true;
 }
 
@@ -844,6 +932,7 @@ bool TFT_eSPI::initDMA(bool ctrl_cs)
 void TFT_eSPI::deInitDMA(void)
 {
   if (!DMA_Enabled) return;
+  dmaWait();
   spi_bus_remove_device(dmaHAL);
   spi_bus_free(spi_host);
   DMA_Enabled = false;
@@ -121,6 +121,12 @@ SPI3_HOST = 2
   #define ESP32_DMA
   // Code to check if DMA is busy, used by SPI DMA + transaction + endWrite functions
   #define DMA_BUSY_CHECK  dmaWait()
+  // Number of DMA pushes that can be queued before the CPU waits (1 to 42). With the default
+  // of 1 each push waits for the previous one to end. Define a larger value in the setup file
+  // to queue pushes, a sketch must then call dmaFence() before it reuses a buffer it pushed
+  #ifndef DMA_QUEUE_SIZE
+    #define DMA_QUEUE_SIZE 1
+  #endif
 #else
   #define DMA_BUSY_CHECK
 #endif
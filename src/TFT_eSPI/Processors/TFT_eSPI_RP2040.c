@@ -603,6 +603,31 @@ void TFT_eSPI::dmaWait(void)
 #endif
 }
 
+/***************************************************************************************
+** Function name:           dmaFence
+** Description:             Wait until a buffer is no longer being sent
+***************************************************************************************/
+// Only one transfer is in progress at a time so this waits for it to end
+void TFT_eSPI::dmaFence(const void* buffer, uint32_t len)
+{
+  (void)buffer;
+  (void)len;
+  dmaWait();
+}
+
+
+/***************************************************************************************
+** Function name:           setAddrWindowDMA
+** Description:             Set the window for pushPixelsDMA()
+***************************************************************************************/
+// The window is set by the CPU, so the transfer in progress must end first
+void TFT_eSPI::setAddrWindowDMA(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  dmaWait();
+  setAddrWindow(x, y, w, h);
+}
+
+
 /***************************************************************************************
 ** Function name:           pushPixelsDMA
 ** Description:             Push pixels to TFT
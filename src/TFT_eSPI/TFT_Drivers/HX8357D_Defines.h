@@ -27,6 +27,10 @@
 
 #define TFT_RAMRD   0x2E
 
+#define TFT_VSCRDEF  0x33 // Vertical scrolling definition
+#define TFT_VSCRSADD 0x37 // Vertical scrolling start address
+#define TFT_VSCR_REVERSE 0x03 // Bit per rotation, set if screen positions run from the end of frame memory
+
 #define TFT_MADCTL  0x36
 
 #define TFT_MAD_MY  0x80
@@ -27,6 +27,9 @@
 
 #define TFT_RAMRD   0x2E
 
+#define TFT_VSCRDEF  0x33 // Vertical scrolling definition
+#define TFT_VSCRSADD 0x37 // Vertical scrolling start address
+
 #define TFT_MADCTL  0x36
 
 #define TFT_MAD_MY  0x80
@@ -23,6 +23,9 @@
 #define TFT_RAMWR   0x2C
 #define TFT_RAMRD   0x2E
 
+#define TFT_VSCRDEF  0x33 // Vertical scrolling definition
+#define TFT_VSCRSADD 0x37 // Vertical scrolling start address
+
 #define TFT_MADCTL  0x36
 #define TFT_MAD_MY  0x80
 #define TFT_MAD_MX  0x40
@@ -1630,11 +1630,11 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint8
 
   setWindow(x, y, x + dw - 1, y + dh - 1); // Sets CS low and sent RAMWR
 
-  // Line buffer makes plotting faster
-  uint16_t  lineBuf[dw];
-
   if (bpp8)
   {
+    // Line buffer makes plotting faster
+    uint16_t  lineBuf[dw];
+
     _swapBytes = false;
 
     uint8_t  blue[] = {0, 11, 21, 31}; // blue 2 to 5-bit colour lookup table
@@ -1656,10 +1656,16 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint8
 
         // Shifts are slow so check if colour has changed first
         if (color != _lastColor) {
-          //          =====Green=====     ===============Red==============
-          msbColor = (color & 0x1C)>>2 | (color & 0xC0)>>3 | (color & 0xE0);
-          //          =====Green=====    =======Blue======
-          lsbColor = (color & 0x1C)<<3 | blue[color & 0x03];
+          if (cmap) { // Palette colour
+            msbColor = cmap[color] >> 8;
+            lsbColor = cmap[color];
+          }
+          else {
+            //          =====Green=====     ===============Red==============
+            msbColor = (color & 0x1C)>>2 | (color & 0xC0)>>3 | (color & 0xE0);
+            //          =====Green=====    =======Blue======
+            lsbColor = (color & 0x1C)<<3 | blue[color & 0x03];
+          }
           _lastColor = color;
         }
 
@@ -1673,73 +1679,27 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint8
     }
     _swapBytes = swap; // Restore old value
   }
-  else if (cmap != nullptr) // Must be 4bpp
+  else // 4bpp with colour map or 1bpp, expanded with a lookup table
   {
-    _swapBytes = true;
-
-    w = (w+1) & 0xFFFE;   // if this is a sprite, w will already be even; this does no harm.
-    bool splitFirst = (dx & 0x01) != 0; // split first means we have to push a single px from the left of the sprite / image
-
-    if (splitFirst) {
-      data += ((dx - 1 + dy * w) >> 1);
-    }
-    else {
-      data += ((dx + dy * w) >> 1);
-    }
-
-    while (dh--) {
-      uint32_t len = dw;
-      uint8_t * ptr = (uint8_t*)data;
-      uint16_t *linePtr = lineBuf;
-      uint8_t colors; // two colors in one byte
-      uint16_t index;
-
-      if (splitFirst) {
-        colors = pgm_read_byte(ptr);
-        index = (colors & 0x0F);
-        *linePtr++ = cmap[index];
-        len--;
-        ptr++;
-      }
+    uint32_t *lut = nullptr;
+    if (cmap != nullptr) lut = paletteLUT(cmap);
 
-      while (len--)
+    if ((cmap == nullptr) || lut) pushPaletteLines(data, w, dx, dy, dw, dh, lut, true);
+    else // No memory for the table
+    {
+      uint16_t  lineBuf[dw];
+      _swapBytes = true;
+      data += (dx >> 1) + dy * ((w + 1) >> 1);
+      while (dh--)
       {
-        colors = pgm_read_byte(ptr);
-        index = ((colors & 0xF0) >> 4) & 0x0F;
-        *linePtr++ = cmap[index];
-
-        if (len--)
+        for (int32_t xp = dx; xp < dx + dw; xp++)
         {
-          index = colors & 0x0F;
-          *linePtr++ = cmap[index];
-        } else {
-          break;  // nothing to do here
+          uint8_t colors = pgm_read_byte(data + ((xp >> 1) - (dx >> 1)));
+          lineBuf[xp - dx] = cmap[(xp & 1) ? (colors & 0x0F) : (colors >> 4)];
         }
-
-        ptr++;
+        pushPixels(lineBuf, dw);
+        data += (w + 1) >> 1;
       }
-
-      pushPixels(lineBuf, dw);
-      data += (w >> 1);
-    }
-    _swapBytes = swap; // Restore old value
-  }
-  else // Must be 1bpp
-  {
-    _swapBytes = false;
-    uint8_t * ptr = (uint8_t*)data;
-    uint32_t ww =  (w+7)>>3; // Width of source image line in bytes
-    for (int32_t yp = dy;  yp < dy + dh; yp++)
-    {
-      uint8_t* linePtr = (uint8_t*)lineBuf;
-      for (int32_t xp = dx; xp < dx + dw; xp++)
-      {
-        uint16_t col = (pgm_read_byte(ptr + (xp>>3)) & (0x80 >> (xp & 0x7)) );
-        if (col) {*linePtr++ = bitmap_fg>>8; *linePtr++ = (uint8_t) bitmap_fg;}
-        else     {*linePtr++ = bitmap_bg>>8; *linePtr++ = (uint8_t) bitmap_bg;}
-      }
-      ptr += ww;
-      pushPixels(lineBuf, dw);
     }
   }
 
@@ -1763,11 +1723,11 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *da
 
   setWindow(x, y, x + dw - 1, y + dh - 1); // Sets CS low and sent RAMWR
 
-  // Line buffer makes plotting faster
-  uint16_t  lineBuf[dw];
-
   if (bpp8)
   {
+    // Line buffer makes plotting faster
+    uint16_t  lineBuf[dw];
+
     _swapBytes = false;
 
     uint8_t  blue[] = {0, 11, 21, 31}; // blue 2 to 5-bit colour lookup table
@@ -1789,10 +1749,16 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *da
 
         // Shifts are slow so check if colour has changed first
         if (color != _lastColor) {
-          //          =====Green=====     ===============Red==============
-          msbColor = (color & 0x1C)>>2 | (color & 0xC0)>>3 | (color & 0xE0);
-          //          =====Green=====    =======Blue======
-          lsbColor = (color & 0x1C)<<3 | blue[color & 0x03];
+          if (cmap) { // Palette colour
+            msbColor = cmap[color] >> 8;
+            lsbColor = cmap[color];
+          }
+          else {
+            //          =====Green=====     ===============Red==============
+            msbColor = (color & 0x1C)>>2 | (color & 0xC0)>>3 | (color & 0xE0);
+            //          =====Green=====    =======Blue======
+            lsbColor = (color & 0x1C)<<3 | blue[color & 0x03];
+          }
           _lastColor = color;
         }
 
@@ -1806,79 +1772,192 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *da
     }
     _swapBytes = swap; // Restore old value
   }
-  else if (cmap != nullptr) // Must be 4bpp
+  else // 4bpp with colour map or 1bpp, expanded with a lookup table
   {
-    _swapBytes = true;
-
-    w = (w+1) & 0xFFFE;   // if this is a sprite, w will already be even; this does no harm.
-    bool splitFirst = (dx & 0x01) != 0; // split first means we have to push a single px from the left of the sprite / image
+    uint32_t *lut = nullptr;
+    if (cmap != nullptr) lut = paletteLUT(cmap);
 
-    if (splitFirst) {
-      data += ((dx - 1 + dy * w) >> 1);
-    }
-    else {
-      data += ((dx + dy * w) >> 1);
+    if ((cmap == nullptr) || lut) pushPaletteLines(data, w, dx, dy, dw, dh, lut, false);
+    else // No memory for the table
+    {
+      uint16_t  lineBuf[dw];
+      _swapBytes = true;
+      data += (dx >> 1) + dy * ((w + 1) >> 1);
+      while (dh--)
+      {
+        for (int32_t xp = dx; xp < dx + dw; xp++)
+        {
+          uint8_t colors = data[(xp >> 1) - (dx >> 1)];
+          lineBuf[xp - dx] = cmap[(xp & 1) ? (colors & 0x0F) : (colors >> 4)];
+        }
+        pushPixels(lineBuf, dw);
+        data += (w + 1) >> 1;
+      }
     }
+  }
 
-    while (dh--) {
-      uint32_t len = dw;
-      uint8_t * ptr = data;
-      uint16_t *linePtr = lineBuf;
-      uint8_t colors; // two colors in one byte
-      uint16_t index;
+  _swapBytes = swap; // Restore old value
+  inTransaction = lockTransaction;
+  end_tft_write();
+}
 
-      if (splitFirst) {
-        colors = *ptr;
-        index = (colors & 0x0F);
-        *linePtr++ = cmap[index];
-        len--;
-        ptr++;
-      }
 
-      while (len--)
-      {
-        colors = *ptr;
-        index = ((colors & 0xF0) >> 4) & 0x0F;
-        *linePtr++ = cmap[index];
+/***************************************************************************************
+** Function name:           paletteLUT
+** Description:             Return table expanding a 4bpp byte to 2 pixels with cmap
+***************************************************************************************/
+// The table is allocated when first needed and only rebuilt if the colour map content
+// changes (e.g. Sprite createPalette() or setPaletteColor()). Each entry holds the 2
+// pixel colours, high nibble first, byte swapped ready for pushPixels()
+uint32_t* TFT_eSPI::paletteLUT(uint16_t *cmap)
+{
+  if (_lut4 == nullptr)
+  {
+    _lut4 = (uint32_t*)malloc(256 * sizeof(uint32_t));
+    if (_lut4 == nullptr) return nullptr;
+    _lut4Valid = false;
+  }
 
-        if (len--)
-        {
-          index = colors & 0x0F;
-          *linePtr++ = cmap[index];
-        } else {
-          break;  // nothing to do here
-        }
+  if (_lut4Valid && !memcmp(_lut4Map, cmap, sizeof(_lut4Map))) return _lut4;
 
-        ptr++;
-      }
+  memcpy(_lut4Map, cmap, sizeof(_lut4Map));
 
-      pushPixels(lineBuf, dw);
-      data += (w >> 1);
-    }
-    _swapBytes = swap; // Restore old value
+  uint16_t *ptr = (uint16_t*)_lut4;
+  for (uint16_t i = 0; i < 256; i++)
+  {
+    uint16_t c1 = cmap[i >> 4];
+    uint16_t c2 = cmap[i & 0x0F];
+    *ptr++ = c1 << 8 | c1 >> 8;
+    *ptr++ = c2 << 8 | c2 >> 8;
   }
-  else // Must be 1bpp
+
+  _lut4Valid = true;
+
+  return _lut4;
+}
+
+
+/***************************************************************************************
+** Function name:           deletePaletteLUT
+** Description:             Free the 4bpp expansion table
+***************************************************************************************/
+// The table is shared by all 4bpp Sprites so is kept until the sketch frees it, it is allocated again when next needed
+void TFT_eSPI::deletePaletteLUT(void)
+{
+  if (_lut4 != nullptr) free(_lut4);
+  _lut4 = nullptr;
+  _lut4Valid = false;
+}
+
+
+/***************************************************************************************
+** Function name:           pushPaletteLines
+** Description:             Expand 4bpp or 1bpp image lines with a table and push them
+***************************************************************************************/
+// The window must have been set. w is the image width, dx,dy,dw,dh the area to push.
+// For 4bpp lut is a table from paletteLUT(), for 1bpp lut is nullptr and bitmap_fg/bg
+// are used. Whole source bytes are expanded a line at a time into a word aligned buffer.
+// If DMA is enabled and the sketch has called startWrite(), as DMA requires, two heap
+// line buffers are used so a line is expanded while the previous one is sent.
+void TFT_eSPI::pushPaletteLines(const uint8_t *data, int32_t w, int32_t dx, int32_t dy, int32_t dw, int32_t dh,
+                                uint32_t *lut, bool flash)
+{
+  uint32_t bytes;  // Source bytes per line
+  uint32_t skip;   // Pixels to skip in the first byte
+  uint32_t len;    // Source bytes to expand per line
+  uint32_t words;  // Line buffer 32-bit words
+
+  uint32_t lut1[32]; // 1bpp nibble to 4 pixel table
+
+  if (lut)
   {
-    _swapBytes = false;
+    bytes = (w + 1) >> 1;
+    data += (dx >> 1) + dy * bytes;
+    skip  = dx & 1;
+    len   = (skip + dw + 1) >> 1;
+    words = len;
+  }
+  else
+  {
+    uint16_t fg = bitmap_fg << 8 | bitmap_fg >> 8;
+    uint16_t bg = bitmap_bg << 8 | bitmap_bg >> 8;
+    uint16_t *ptr = (uint16_t*)lut1;
+    for (uint8_t i = 0; i < 16; i++)
+      for (uint8_t mask = 0x08; mask; mask >>= 1) *ptr++ = (i & mask) ? fg : bg;
+
+    bytes = (w + 7) >> 3;
+    data += (dx >> 3) + dy * bytes;
+    skip  = dx & 7;
+    len   = (skip + dw + 7) >> 3;
+    words = len << 2;
+  }
 
-    uint32_t ww =  (w+7)>>3; // Width of source image line in bytes
-    for (int32_t yp = dy;  yp < dy + dh; yp++)
+  uint32_t *dmaBuf = nullptr;
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+  bool dma = DMA_Enabled && lockTransaction && (dh > 1);
+  // DMA buffers must stay valid until sent, so not on the stack. Push without DMA if none free
+  #if defined (ESP32_DMA)
+  if (dma) dmaBuf = (uint32_t*)heap_caps_malloc(words * 8, MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+  #else
+  if (dma) dmaBuf = (uint32_t*)malloc(words * 8);
+  #endif
+  dma = (dmaBuf != nullptr);
+#else
+  bool dma = false;
+#endif
+
+  uint32_t stackBuf[dma ? 1 : words];
+  uint32_t *lineBuf = dma ? dmaBuf : stackBuf;
+
+  bool swap = _swapBytes;
+  _swapBytes = false; // Table entries are already byte swapped
+
+  for (int32_t line = 0; line < dh; line++)
+  {
+    uint32_t *buf = lineBuf + (dma ? (line & 1) * words : 0);
+    uint32_t *dst = buf;
+
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+    if (dma) dmaFence(buf, words * 4); // Wait only if this buffer is still being sent
+#endif
+
+    if (lut)
     {
-      uint8_t* linePtr = (uint8_t*)lineBuf;
-      for (int32_t xp = dx; xp < dx + dw; xp++)
+      if (flash) for (uint32_t i = 0; i < len; i++) *dst++ = lut[pgm_read_byte(data + i)];
+      else       for (uint32_t i = 0; i < len; i++) *dst++ = lut[data[i]];
+    }
+    else
+    {
+      for (uint32_t i = 0; i < len; i++)
       {
-        uint16_t col = (data[(xp>>3)] & (0x80 >> (xp & 0x7)) );
-        if (col) {*linePtr++ = bitmap_fg>>8; *linePtr++ = (uint8_t) bitmap_fg;}
-        else     {*linePtr++ = bitmap_bg>>8; *linePtr++ = (uint8_t) bitmap_bg;}
+        uint8_t b = flash ? pgm_read_byte(data + i) : data[i];
+        uint32_t *hi = lut1 + ((b >> 4) << 1);
+        uint32_t *lo = lut1 + ((b & 0x0F) << 1);
+        dst[0] = hi[0]; dst[1] = hi[1];
+        dst[2] = lo[0]; dst[3] = lo[1];
+        dst += 4;
       }
-      data += ww;
-      pushPixels(lineBuf, dw);
     }
+
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+    if (dma) {
+      uint16_t *pix = (uint16_t*)buf + skip;
+      // DMA needs a word aligned start, move the line down one pixel if skip is odd
+      if (skip & 1) { memmove(pix - 1, pix, dw * 2); pix--; }
+      pushPixelsDMA(pix, dw);
+    }
+    else
+#endif
+    pushPixels((uint16_t*)buf + skip, dw);
+
+    data += bytes;
   }
 
-  _swapBytes = swap; // Restore old value
-  inTransaction = lockTransaction;
-  end_tft_write();
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+  if (dma) { dmaWait(); free(dmaBuf); }
+#endif
+
+  _swapBytes = swap;
 }
 
 
@@ -1927,10 +2006,16 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *da
 
           // Shifts are slow so check if colour has changed first
           if (color != _lastColor) {
-            //          =====Green=====     ===============Red==============
-            msbColor = (color & 0x1C)>>2 | (color & 0xC0)>>3 | (color & 0xE0);
-            //          =====Green=====    =======Blue======
-            lsbColor = (color & 0x1C)<<3 | blue[color & 0x03];
+            if (cmap) { // Palette colour
+              msbColor = cmap[color] >> 8;
+              lsbColor = cmap[color];
+            }
+            else {
+              //          =====Green=====     ===============Red==============
+              msbColor = (color & 0x1C)>>2 | (color & 0xC0)>>3 | (color & 0xE0);
+              //          =====Green=====    =======Blue======
+              lsbColor = (color & 0x1C)<<3 | blue[color & 0x03];
+            }
             _lastColor = color;
           }
           *linePtr++ = msbColor;
@@ -2755,6 +2840,185 @@ void TFT_eSPI::fillTriangle ( int32_t x0, int32_t y0, int32_t x1, int32_t y1, in
 }
 
 
+/***************************************************************************************
+** Function name:           fillPolygon
+** Description:             Fill a polygon using an active edge table
+***************************************************************************************/
+void TFT_eSPI::fillPolygon(const int16_t *xs, const int16_t *ys, uint16_t n, uint32_t color)
+{
+  if (_vpOoB || !xs || !ys || n < 3) return;
+
+  // Edges and the active edge list, on the stack for small polygons
+  polyEdge  edge[16];
+  uint16_t  act[16];
+  polyEdge *e = edge;
+  uint16_t *a = act;
+
+  if (n > 16) {
+    e = (polyEdge*)malloc(n * (sizeof(polyEdge) + sizeof(uint16_t)));
+    if (!e) return;
+    a = (uint16_t*)(e + n);
+  }
+
+  // Horizontal edges cross no row centres so are left out
+  uint16_t ne = 0;
+  for (uint16_t i = 0, j = n - 1; i < n; j = i++) {
+    if (setPolyEdge(e + ne, xs[j], ys[j], xs[i], ys[i])) ne++;
+  }
+
+  begin_nin_write();
+  inTransaction = true;
+
+  fillPolyEdges(e, a, ne, color);
+
+  inTransaction = lockTransaction;
+  end_nin_write();
+
+  if (e != edge) free(e);
+}
+
+
+/***************************************************************************************
+** Function name:           fillTriangles
+** Description:             Fill a triangle mesh
+***************************************************************************************/
+void TFT_eSPI::fillTriangles(const int16_t *vertices, const uint16_t *indices, uint16_t count, uint32_t color)
+{
+  if (_vpOoB || !vertices) return;
+
+  begin_nin_write();
+  inTransaction = true;
+
+  polyEdge e[3];
+  uint16_t act[3];
+
+  for (uint32_t t = 0; t < count; t++) {
+    uint32_t v[3]; // Vertex numbers, without indices these pass 65535 after 21845 triangles
+    for (uint8_t k = 0; k < 3; k++) v[k] = indices ? indices[3 * t + k] : 3 * t + k;
+
+    uint16_t ne = 0;
+    for (uint8_t i = 0, j = 2; i < 3; j = i++) {
+      if (setPolyEdge(e + ne, vertices[2 * v[j]], vertices[2 * v[j] + 1], vertices[2 * v[i]], vertices[2 * v[i] + 1])) ne++;
+    }
+    fillPolyEdges(e, act, ne, color);
+  }
+
+  inTransaction = lockTransaction;
+  end_nin_write();
+}
+
+
+/***************************************************************************************
+** Function name:           setPolyEdge (private function)
+** Description:             Set up a polygon edge, returns false if it is horizontal
+***************************************************************************************/
+// Edges are stored top to bottom so an edge shared by two polygons gives the same x
+// crossings for both of them. With dy = y1 - y0 and dx = x1 - x0, the first pixel with a
+// centre on or right of the crossing of row y is ceil(N / 2dy), where
+// N = 2dy * x0 + (2 * (y - y0) + 1) * dx - dy. N = x * d + r is kept as a quotient and
+// remainder so no rounding errors add up along the edge.
+bool TFT_eSPI::setPolyEdge(polyEdge *e, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+  if (y0 == y1) return false;
+  if (y0 > y1) {
+    transpose(x0, x1);
+    transpose(y0, y1);
+  }
+
+  int32_t dx = x1 - x0, dy = y1 - y0;
+  int64_t num = (int64_t)2 * dy * x0 + dx - dy;
+
+  e->d  = 2 * dy;
+  e->x  = num / e->d;
+  e->r  = num % e->d;
+  if (e->r < 0) { e->r += e->d; e->x--; }
+
+  e->dx = (2 * dx) / e->d;
+  e->dr = (2 * dx) % e->d;
+  if (e->dr < 0) { e->dr += e->d; e->dx--; }
+
+  e->y0 = y0;
+  e->y1 = y1;
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           fillPolyEdges (private function)
+** Description:             Fill the rows crossed by polygon edges, even-odd rule
+***************************************************************************************/
+// A pixel is filled if its centre lies inside. For each pair of crossings a row is
+// filled from the first pixel on or right of the left crossing up to, but not including,
+// the first pixel on or right of the right crossing.
+void TFT_eSPI::fillPolyEdges(polyEdge *e, uint16_t *act, uint16_t n, uint32_t color)
+{
+  if (n < 2) return;
+
+  // Sort by top row, insertion sort as n is normally small
+  for (uint16_t i = 1; i < n; i++) {
+    polyEdge t = e[i];
+    int32_t j = i - 1;
+    while (j >= 0 && e[j].y0 > t.y0) { e[j + 1] = e[j]; j--; }
+    e[j + 1] = t;
+  }
+
+  // Rows in the viewport
+  int32_t y = e[0].y0, yEnd = e[0].y1;
+  for (uint16_t i = 1; i < n; i++) if (e[i].y1 > yEnd) yEnd = e[i].y1;
+  if (y < _vpY - _yDatum) y = _vpY - _yDatum;
+  if (yEnd > _vpH - _yDatum) yEnd = _vpH - _yDatum;
+
+  uint16_t next = 0, na = 0;
+
+  for (; y < yEnd; y++) {
+    // Drop edges that end above this row
+    uint16_t k = 0;
+    for (uint16_t i = 0; i < na; i++) if (e[act[i]].y1 > y) act[k++] = act[i];
+    na = k;
+
+    // Add edges that start on or above this row, moving the crossing down to the row if clipped
+    while (next < n && e[next].y0 <= y) {
+      polyEdge *p = e + next;
+      if (p->y1 > y) {
+        if (p->y0 < y) {
+          int64_t num = (int64_t)p->x * p->d + p->r + (int64_t)(y - p->y0) * (p->dx * p->d + p->dr);
+          p->x = num / p->d;
+          p->r = num % p->d;
+          if (p->r < 0) { p->r += p->d; p->x--; }
+        }
+        act[na++] = next;
+      }
+      next++;
+    }
+
+    // Sort active edges by pixel, the order rarely changes between rows
+    for (uint16_t i = 1; i < na; i++) {
+      uint16_t t = act[i];
+      int32_t  xt = e[t].x + (e[t].r > 0);
+      int32_t j = i - 1;
+      while (j >= 0 && e[act[j]].x + (e[act[j]].r > 0) > xt) { act[j + 1] = act[j]; j--; }
+      act[j + 1] = t;
+    }
+
+    for (uint16_t i = 0; i + 1 < na; i += 2) {
+      int32_t xa = e[act[i]].x + (e[act[i]].r > 0);
+      int32_t xb = e[act[i + 1]].x + (e[act[i + 1]].r > 0);
+      if (xb > xa) drawFastHLine(xa, y, xb - xa, color);
+    }
+
+    for (uint16_t i = 0; i < na; i++) {
+      polyEdge *p = e + act[i];
+      p->x += p->dx;
+      p->r += p->dr;
+      if (p->r >= p->d) { p->r -= p->d; p->x++; }
+    }
+
+    if (!na && next >= n) break;
+  }
+}
+
+
 /***************************************************************************************
 ** Function name:           drawBitmap
 ** Description:             Draw an image stored in an array on the TFT
@@ -3231,27 +3495,21 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32
     //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
     inTransaction = true;
 
-    for (int8_t i = 0; i < 6; i++ ) {
-      uint8_t line;
-      if (i == 5)
-        line = 0x0;
-      else
-        line = pgm_read_byte(&font[0] + (c * 5) + i);
+    uint8_t column[6];
+    for (int8_t i = 0; i < 5; i++ ) column[i] = pgm_read_byte(&font[0] + (c * 5) + i);
+    column[5] = 0;
 
-      if (size == 1 && !fillbg) { // default size
+    if (size == 1 && !fillbg) { // default size
+      for (int8_t i = 0; i < 6; i++ ) {
+        uint8_t line = column[i];
         for (int8_t j = 0; j < 8; j++) {
           if (line & 0x1) drawPixel(x + i, y + j, color);
           line >>= 1;
         }
       }
-      else {  // big size or clipped
-        for (int8_t j = 0; j < 8; j++) {
-          if (line & 0x1) fillRect(x + (i * size), y + (j * size), size, size, color);
-          else if (fillbg) fillRect(x + i * size, y + j * size, size, size, bg);
-          line >>= 1;
-        }
-      }
     }
+    else drawGlcdRuns(column, 6, x, y, color, bg, size); // big size or clipped
+
     inTransaction = lockTransaction;
     end_tft_write();              // Does nothing if Sprite class uses this function
   }
@@ -3337,6 +3595,164 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32
 }
 
 
+/***************************************************************************************
+** Function name:           drawGlcdRuns
+** Description:             draw columns of GLCD font bits as scaled runs
+***************************************************************************************/
+// Each glyph row is split into runs of set (color) and clear (bg) bits across all n
+// columns, and identical rows are merged, so each run is one fillRect() instead of one
+// per bit. bg runs are only drawn if bg != color. Coordinates are viewport relative.
+void TFT_eSPI::drawGlcdRuns(const uint8_t *column, int32_t n, int32_t x, int32_t y,
+                            uint32_t color, uint32_t bg, uint8_t size)
+{
+  bool fillbg = (bg != color);
+  int32_t j = 0;
+
+  while (j < 8) {
+    // Count following rows with the same bit pattern
+    int32_t h = 1;
+    while (j + h < 8) {
+      int32_t k = 0;
+      while (k < n && !(((column[k] >> j) ^ (column[k] >> (j + h))) & 0x1)) k++;
+      if (k < n) break;
+      h++;
+    }
+
+    int32_t k = 0;
+    while (k < n) {
+      uint8_t bit = (column[k] >> j) & 0x1;
+      int32_t k0 = k;
+      while (++k < n && ((column[k] >> j) & 0x1) == bit);
+      if (bit) fillRect(x + k0 * size, y + j * size, (k - k0) * size, h * size, color);
+      else if (fillbg) fillRect(x + k0 * size, y + j * size, (k - k0) * size, h * size, bg);
+    }
+    j += h;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           drawGlcdString
+** Description:             draw a string in the scaled GLCD font, return width
+***************************************************************************************/
+// Characters are buffered so runs of pixels are merged across adjacent characters
+#define GLCD_RUN_CHARS 16
+int16_t TFT_eSPI::drawGlcdString(const char *string, int32_t x, int32_t y)
+{
+  if (_vpOoB) return 0;
+
+  uint8_t  column[GLCD_RUN_CHARS * 6];
+  int32_t  n = 0;      // Number of buffered columns
+  int32_t  xs = x;     // Position of first buffered column
+  int16_t  sumX = 0;
+  uint16_t len = strlen(string);
+  uint16_t i = 0;
+
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  inTransaction = true;
+
+  while (i < len) {
+    uint16_t c = decodeUTF8((uint8_t*)string, &i, len - i);
+    if (!c) continue;
+
+    if (c < 32 || c > 255) {
+      // Not buffered, let drawChar() handle these as it does now
+      if (n) drawGlcdRuns(column, n, xs, y, textcolor, textbgcolor, textsize);
+      n = 0;
+      drawChar(x + sumX, y, c, textcolor, textbgcolor, textsize);
+      sumX += 6 * textsize;
+      xs = x + sumX;
+      continue;
+    }
+
+    if (!_cp437 && c > 175) c++;
+
+    for (int8_t k = 0; k < 5; k++ ) column[n++] = pgm_read_byte(&font[0] + (c * 5) + k);
+    column[n++] = 0;
+    sumX += 6 * textsize;
+
+    if (n == sizeof(column)) {
+      drawGlcdRuns(column, n, xs, y, textcolor, textbgcolor, textsize);
+      n = 0;
+      xs = x + sumX;
+    }
+  }
+
+  if (n) drawGlcdRuns(column, n, xs, y, textcolor, textbgcolor, textsize);
+
+  inTransaction = lockTransaction;
+  end_tft_write();              // Does nothing if Sprite class uses this function
+
+  return sumX;
+}
+
+
+/***************************************************************************************
+** Function name:           rleRow (static)
+** Description:             decode one character row of a run length encoded font
+***************************************************************************************/
+// Sets row[] to 1 for foreground and 0 for background pixels. *run and *set hold the
+// part of the current run that continues onto the next row.
+static void rleRow(const uint8_t **rle, uint8_t *run, uint8_t *set, uint8_t *row, int32_t width)
+{
+  for (int32_t i = 0; i < width; i++) {
+    if (*run == 0) {
+      uint8_t line = pgm_read_byte(*rle);
+      (*rle)++;
+      *set = line >> 7;
+      *run = (line & 0x7F) + 1;
+    }
+    row[i] = *set;
+    (*run)--;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           drawRleRuns
+** Description:             draw a run length encoded font character as scaled runs
+***************************************************************************************/
+// The character is decoded a row at a time and identical rows are merged, so each run
+// of pixels is one fillRect() whatever the size. bg runs are only drawn if bg != color.
+// Coordinates are viewport relative.
+void TFT_eSPI::drawRleRuns(const uint8_t *rle, int32_t width, int32_t height, int32_t x, int32_t y,
+                           uint32_t color, uint32_t bg, uint8_t size)
+{
+  if (width <= 0 || height <= 0) return;
+
+  bool fillbg = (bg != color);
+  uint8_t buf[2 * width];
+  uint8_t *row  = buf;
+  uint8_t *next = buf + width;
+  uint8_t run = 0, set = 0;
+
+  rleRow(&rle, &run, &set, row, width);
+
+  int32_t j = 0;
+  while (j < height) {
+    // Count following rows with the same pixels
+    int32_t h = 1;
+    while (j + h < height) {
+      rleRow(&rle, &run, &set, next, width);
+      if (memcmp(row, next, width)) break;
+      h++;
+    }
+
+    int32_t k = 0;
+    while (k < width) {
+      uint8_t bit = row[k];
+      int32_t k0 = k;
+      while (++k < width && row[k] == bit);
+      if (bit) fillRect(x + k0 * size, y + j * size, (k - k0) * size, h * size, color);
+      else if (fillbg) fillRect(x + k0 * size, y + j * size, (k - k0) * size, h * size, bg);
+    }
+
+    j += h;
+    uint8_t *t = row; row = next; next = t;
+  }
+}
+
+
 /***************************************************************************************
 ** Function name:           setAddrWindow
 ** Description:             define an area to receive a stream of pixels
@@ -3944,6 +4360,157 @@ void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t
 }
 
 
+/***************************************************************************************
+** Function name:           drawPolyline
+** Description:             draw joined lines through n points
+***************************************************************************************/
+void TFT_eSPI::drawPolyline(const int16_t *xs, const int16_t *ys, uint16_t n, uint32_t color)
+{
+  if (_vpOoB || !xs || !ys || !n) return;
+
+  // Nothing to do if the bounding box is outside the viewport
+  int32_t x0 = xs[0], x1 = xs[0], y0 = ys[0], y1 = ys[0];
+  for (uint16_t i = 1; i < n; i++) {
+    if (xs[i] < x0) x0 = xs[i];
+    if (xs[i] > x1) x1 = xs[i];
+    if (ys[i] < y0) y0 = ys[i];
+    if (ys[i] > y1) y1 = ys[i];
+  }
+  if ((x1 + _xDatum < _vpX) || (x0 + _xDatum >= _vpW) || (y1 + _yDatum < _vpY) || (y0 + _yDatum >= _vpH)) return;
+
+  begin_nin_write();
+  inTransaction = true;
+
+  lineRun run = { 0, 0, 0, false };
+  polylineSegment(&run, xs[0], ys[0], xs[0], ys[0], true, color);
+  for (uint16_t i = 1; i < n; i++) {
+    polylineSegment(&run, xs[i - 1], ys[i - 1], xs[i], ys[i], false, color);
+  }
+  addLineRun(&run, 0, 0, 0, false, color); // Draw the last run
+
+  inTransaction = lockTransaction;
+  end_nin_write();
+}
+
+
+/***************************************************************************************
+** Function name:           plotSeries
+** Description:             draw n values as joined lines
+***************************************************************************************/
+void TFT_eSPI::plotSeries(const float *values, uint16_t n, int32_t x0, float stepX, float yOffset, float yScale, uint32_t color)
+{
+  if (_vpOoB || !values || !n) return;
+
+  begin_nin_write();
+  inTransaction = true;
+
+  lineRun run = { 0, 0, 0, false };
+  int32_t px = 0, py = 0;
+  bool joined = false;
+
+  for (uint16_t i = 0; i < n; i++) {
+    if (isnan(values[i])) { joined = false; continue; } // Gap
+
+    float fy = yOffset + values[i] * yScale;
+    if (fy < -32768.0f) fy = -32768.0f;
+    else if (fy > 32767.0f) fy = 32767.0f;
+
+    int32_t x = x0 + (int32_t)floorf(i * stepX + 0.5f);
+    int32_t y = (int32_t)floorf(fy + 0.5f);
+
+    if (joined) polylineSegment(&run, px, py, x, y, false, color);
+    else polylineSegment(&run, x, y, x, y, true, color);
+
+    px = x; py = y;
+    joined = true;
+  }
+  addLineRun(&run, 0, 0, 0, false, color); // Draw the last run
+
+  inTransaction = lockTransaction;
+  end_nin_write();
+}
+
+
+/***************************************************************************************
+** Function name:           polylineSegment (private function)
+** Description:             add the runs of pixels of one line to a run being built
+***************************************************************************************/
+// Bresenham's algorithm as for drawLine(), so the same pixels are set. The x0,y0 pixel
+// has been drawn by the previous line of a polyline so it is left out unless first is true.
+void TFT_eSPI::polylineSegment(lineRun *run, int32_t x0, int32_t y0, int32_t x1, int32_t y1, bool first, uint32_t color)
+{
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) {
+    transpose(x0, y0);
+    transpose(x1, y1);
+  }
+
+  // Major axis range to draw
+  int32_t lo = x0 + !first, hi = x1;
+  if (x0 > x1) {
+    transpose(x0, x1);
+    transpose(y0, y1);
+    lo = x0;
+    hi = x1 - !first;
+  }
+
+  int32_t dx = x1 - x0, dy = abs(y1 - y0);
+
+  int32_t err = dx >> 1, ystep = -1, xs = x0;
+
+  if (y0 < y1) ystep = 1;
+
+  for (; x0 <= x1; x0++) {
+    err -= dy;
+    if (err < 0 || x0 == x1) {
+      // Run xs to x0 on row y0, clipped to the range
+      int32_t s = (xs < lo) ? lo : xs;
+      int32_t e = (x0 > hi) ? hi : x0;
+      if (e >= s) {
+        if (steep) addLineRun(run, y0, s, e - s + 1, true, color);
+        else addLineRun(run, s, y0, e - s + 1, false, color);
+      }
+      y0 += ystep; xs = x0 + 1;
+      err += dx;
+    }
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           addLineRun (private function)
+** Description:             merge a run of pixels with the run being built, or draw it
+***************************************************************************************/
+// A single pixel can join a run in either direction. len = 0 draws the run being built.
+void TFT_eSPI::addLineRun(lineRun *run, int32_t x, int32_t y, int32_t len, bool vertical, uint32_t color)
+{
+  if (run->len && len) {
+    bool v = (run->len > 1) ? run->v : (len > 1) ? vertical : (run->x == x);
+    if ((len == 1 || vertical == v) && (v ? (x == run->x) : (y == run->y))) {
+      int32_t *rs = v ? &run->y : &run->x;
+      int32_t  ns = v ? y : x;
+      if ((ns == *rs + run->len) || (ns + len == *rs)) {
+        if (ns < *rs) *rs = ns;
+        run->len += len;
+        run->v = v;
+        return;
+      }
+    }
+  }
+
+  if (run->len == 1) drawPixel(run->x, run->y, color);
+  else if (run->len) {
+    if (run->v) drawFastVLine(run->x, run->y, run->len, color);
+    else drawFastHLine(run->x, run->y, run->len, color);
+  }
+
+  run->x = x;
+  run->y = y;
+  run->len = len;
+  run->v = vertical;
+}
+
+
 /***************************************************************************************
 ** Description:  Constants for anti-aliased line drawing on TFT and in Sprites
 ***************************************************************************************/
@@ -3965,6 +4532,74 @@ uint16_t TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color, uint8_t alpha
 }
 
 
+/***************************************************************************************
+** Function name:           readSpan
+** Description:             Read a line of n pixel colours at x,y from the TFT
+***************************************************************************************/
+// Colours are returned in 565 format (not byte swapped), the line is clipped to the viewport
+void TFT_eSPI::readSpan(int32_t x, int32_t y, int32_t n, uint16_t *data)
+{
+  readRect(x, y, n, 1, data);
+  while (n--) { *data = *data >> 8 | *data << 8; data++; }
+}
+
+
+/***************************************************************************************
+** Function name:           writeSpan
+** Description:             Write a line of n pixel colours at x,y to the TFT
+***************************************************************************************/
+// Colours are in 565 format (not byte swapped), the line is clipped to the viewport
+void TFT_eSPI::writeSpan(int32_t x, int32_t y, int32_t n, uint16_t *data)
+{
+  bool swap = _swapBytes;
+  _swapBytes = true;
+  pushImage(x, y, n, 1, data);
+  _swapBytes = swap;
+}
+
+
+/***************************************************************************************
+** Function name:           drawAlphaSpan (private function)
+** Description:             Draw a line of pixels with coverage alpha[] at x,y
+***************************************************************************************/
+// Smooth graphics support function, each row of an anti-aliased shape is drawn with a
+// single write. Pixels are colour blended with bg_color, or if bg_color is 0x00FFFFFF with
+// the existing pixels, which are fetched with one read per run of partly covered pixels.
+void TFT_eSPI::drawAlphaSpan(int32_t x, int32_t y, const uint8_t *alpha, int32_t n, uint32_t color, uint32_t bg_color)
+{
+  if (_vpOoB) return;
+
+  // Clip to the viewport
+  int32_t xd = x + _xDatum;
+  int32_t yd = y + _yDatum;
+
+  if ((yd < _vpY) || (yd >= _vpH)) return;
+
+  if (xd < _vpX) { alpha += _vpX - xd; n -= _vpX - xd; x += _vpX - xd; xd = _vpX; }
+  if ((xd + n) > _vpW) n = _vpW - xd;
+
+  if (n < 1) return;
+
+  uint16_t line[n];
+
+  if (bg_color == 0x00FFFFFF) {
+    int32_t i = 0;
+    while (i < n) {
+      while (i < n && alpha[i] == 255) i++;
+      int32_t s = i;
+      while (i < n && alpha[i] != 255) i++;
+      if (i > s) readSpan(x + s, y, i - s, line + s);
+    }
+  }
+  else {
+    for (int32_t i = 0; i < n; i++) line[i] = bg_color;
+  }
+
+  blendSpan(line, color, alpha, n);
+  writeSpan(x, y, n, line);
+}
+
+
 /***************************************************************************************
 ** Function name:           drawSmoothArc
 ** Description:             Draw a smooth arc clockwise from 6 o'clock
@@ -4080,6 +4715,10 @@ void TFT_eSPI::drawArc(int32_t x, int32_t y, int32_t r, int32_t ir,
     if (endAngle == 0) return;
     startAngle = 0;
   }
+
+  // Row coverage from the arc cache, nullptr if the cache is off or full
+  const uint16_t* rows = _acBudget ? cachedArc(r, ir, smooth) : nullptr;
+
   inTransaction = true;
 
   int32_t xs = 0;        // x start position for quadrant scan
@@ -4151,8 +4790,15 @@ void TFT_eSPI::drawArc(int32_t x, int32_t y, int32_t r, int32_t ir,
     endSlope[3] =  slope;
   }
 
+  // Coverage of each quadrant line, left side quadrants 0 and 1 are in x order, the
+  // right side quadrants 2 and 3 are mirrored
+  uint8_t qa[4 * r];
+
+  // Cached coverage only needs the arc ends to be found
+  if (rows) drawArcRows(x, y, r, rows, startSlope, endSlope, fg_color, bg_color);
+
   // Scan quadrant
-  for (int32_t cy = r - 1; cy > 0; cy--)
+  else for (int32_t cy = r - 1; cy > 0; cy--)
   {
     uint32_t len[4] = { 0,  0,  0,  0}; // Pixel run length
     int32_t  xst[4] = {-1, -1, -1, -1}; // Pixel run x start
@@ -4170,27 +4816,9 @@ void TFT_eSPI::drawArc(int32_t x, int32_t y, int32_t r, int32_t ir,
       if (hyp > r2) {
         alpha = ~sqrt_fraction(hyp); // Outer AA zone
       }
-      // If within arc fill zone, get line start and lengths for each quadrant
+      // If within arc fill zone the pixel is fully covered
       else if (hyp >= r3) {
-        // Calculate U16.16 slope
-        slope = ((r - cy) << 16)/(r - cx);
-        if (slope <= startSlope[0] && slope >= endSlope[0]) { // slope hi -> lo
-          xst[0] = cx; // Bottom left line end
-          len[0]++;
-        }
-        if (slope >= startSlope[1] && slope <= endSlope[1]) { // slope lo -> hi
-          xst[1] = cx; // Top left line end
-          len[1]++;
-        }
-        if (slope <= startSlope[2] && slope >= endSlope[2]) { // slope hi -> lo
-          xst[2] = cx; // Bottom right line start
-          len[2]++;
-        }
-        if (slope <= endSlope[3] && slope >= startSlope[3]) { // slope lo -> hi
-          xst[3] = cx; // Top right line start
-          len[3]++;
-        }
-        continue; // Next x
+        alpha = 255;
       }
       else {
         if (hyp <= r4) break;  // Skip inner pixels
@@ -4199,24 +4827,30 @@ void TFT_eSPI::drawArc(int32_t x, int32_t y, int32_t r, int32_t ir,
 
       if (alpha < 16) continue;  // Skip low alpha pixels
 
-      // If background is read it must be done in each quadrant
-      uint16_t pcol = fastBlend(alpha, fg_color, bg_color);
-      // Check if an AA pixels need to be drawn
+      // Add pixel to the line of each quadrant it is in, these are continuous runs
       slope = ((r - cy)<<16)/(r - cx);
-      if (slope <= startSlope[0] && slope >= endSlope[0]) // BL
-        drawPixel(x + cx - r, y - cy + r, pcol);
-      if (slope >= startSlope[1] && slope <= endSlope[1]) // TL
-        drawPixel(x + cx - r, y + cy - r, pcol);
-      if (slope <= startSlope[2] && slope >= endSlope[2]) // TR
-        drawPixel(x - cx + r, y + cy - r, pcol);
-      if (slope <= endSlope[3] && slope >= startSlope[3]) // BR
-        drawPixel(x - cx + r, y - cy + r, pcol);
+      if (slope <= startSlope[0] && slope >= endSlope[0]) { // BL, slope hi -> lo
+        if (!len[0]) xst[0] = cx;
+        qa[len[0]++] = alpha;
+      }
+      if (slope >= startSlope[1] && slope <= endSlope[1]) { // TL, slope lo -> hi
+        if (!len[1]) xst[1] = cx;
+        qa[r + len[1]++] = alpha;
+      }
+      if (slope <= startSlope[2] && slope >= endSlope[2]) { // TR, slope hi -> lo
+        if (!len[2]) xst[2] = cx;
+        qa[3 * r - 1 - len[2]++] = alpha;
+      }
+      if (slope <= endSlope[3] && slope >= startSlope[3]) { // BR, slope lo -> hi
+        if (!len[3]) xst[3] = cx;
+        qa[4 * r - 1 - len[3]++] = alpha;
+      }
     }
-    // Add line in inner zone
-    if (len[0]) drawFastHLine(x + xst[0] - len[0] + 1 - r, y - cy + r, len[0], fg_color); // BL
-    if (len[1]) drawFastHLine(x + xst[1] - len[1] + 1 - r, y + cy - r, len[1], fg_color); // TL
-    if (len[2]) drawFastHLine(x - xst[2] + r, y + cy - r, len[2], fg_color); // TR
-    if (len[3]) drawFastHLine(x - xst[3] + r, y - cy + r, len[3], fg_color); // BR
+    // Draw the line in each quadrant
+    if (len[0]) drawAlphaSpan(x + xst[0] - r, y - cy + r, qa, len[0], fg_color, bg_color); // BL
+    if (len[1]) drawAlphaSpan(x + xst[1] - r, y + cy - r, qa + r, len[1], fg_color, bg_color); // TL
+    if (len[2]) drawAlphaSpan(x - xst[2] - len[2] + 1 + r, y + cy - r, qa + 3 * r - len[2], len[2], fg_color, bg_color); // TR
+    if (len[3]) drawAlphaSpan(x - xst[3] - len[3] + 1 + r, y - cy + r, qa + 4 * r - len[3], len[3], fg_color, bg_color); // BR
   }
 
   // Fill in centre lines
@@ -4229,6 +4863,201 @@ void TFT_eSPI::drawArc(int32_t x, int32_t y, int32_t r, int32_t ir,
   end_tft_write();
 }
 
+/***************************************************************************************
+** Function name:           setArcCache
+** Description:             Set the arc coverage cache size in bytes, 0 = no cache
+***************************************************************************************/
+void TFT_eSPI::setArcCache(uint32_t bytes)
+{
+  _acBudget = bytes;
+
+  // Evict least recently used arcs to fit the new size
+  while (_acTail && _acUsed > _acBudget) {
+    arcCacheEntry* e = _acTail;
+    _acTail = e->prev;
+    if (_acTail) _acTail->next = nullptr;
+    else _acHead = nullptr;
+    _acUsed -= sizeof(arcCacheEntry) + e->size;
+    free(e);
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           arcRows (private function)
+** Description:             Find the row coverage of one quadrant of an arc
+***************************************************************************************/
+// This is the drawArc() quadrant scan without the angle tests. For each row, from
+// cy = r - 1 down to 1 (r being the outer AA zone radius), the first x with alpha >= 16
+// and the number of such pixels are stored. The alpha values of the rows follow on.
+uint32_t TFT_eSPI::arcRows(int32_t r, int32_t ir, bool smooth, uint16_t *row, uint8_t *alpha)
+{
+  uint32_t r2 = r * r;   // Outer arc radius^2
+  if (smooth) r++;       // Outer AA zone radius
+  uint32_t r1 = r * r;   // Outer AA radius^2
+  uint32_t r3 = ir * ir; // Inner arc radius^2
+  if (smooth) ir--;      // Inner AA zone radius
+  uint32_t r4 = ir * ir; // Inner AA radius^2
+
+  int32_t  xs = 0;
+  uint32_t total = 0;
+
+  for (int32_t cy = r - 1; cy > 0; cy--)
+  {
+    uint32_t dy2 = (r - cy) * (r - cy);
+    int32_t  x0 = 0;
+    uint16_t n  = 0;
+
+    while ((r - xs) * (r - xs) + dy2 >= r1) xs++;
+
+    for (int32_t cx = xs; cx < r; cx++)
+    {
+      uint32_t hyp = (r - cx) * (r - cx) + dy2;
+      uint8_t  a;
+
+      if (hyp > r2) a = ~sqrt_fraction(hyp);
+      else if (hyp >= r3) a = 255;
+      else {
+        if (hyp <= r4) break;
+        a = sqrt_fraction(hyp);
+      }
+
+      if (a < 16) continue;
+      if (!n) x0 = cx;
+      if (alpha) alpha[total + n] = a;
+      n++;
+    }
+
+    if (row) { *row++ = x0; *row++ = n; }
+    total += n;
+  }
+
+  return total;
+}
+
+
+/***************************************************************************************
+** Function name:           cachedArc (private function)
+** Description:             Return the cached row coverage of an arc, nullptr if none
+***************************************************************************************/
+// Builds the coverage on a miss. Returns nullptr if it does not fit in the cache.
+const uint16_t* TFT_eSPI::cachedArc(int32_t r, int32_t ir, bool smooth)
+{
+  if (r > 0x7FFE) return nullptr;
+
+  // Move to front on a hit, few gauges are drawn so a linear search is used
+  for (arcCacheEntry* e = _acHead; e; e = e->next)
+  {
+    if (e->r != r || e->ir != ir || e->smooth != smooth) continue;
+    if (e != _acHead) {
+      e->prev->next = e->next;
+      if (e->next) e->next->prev = e->prev;
+      else _acTail = e->prev;
+      e->prev = nullptr;
+      e->next = _acHead;
+      _acHead->prev = e;
+      _acHead = e;
+    }
+    return (const uint16_t*)(e + 1);
+  }
+
+  uint32_t rowBytes = 4 * (r + smooth - 1);
+  uint32_t size = rowBytes + arcRows(r, ir, smooth, nullptr, nullptr);
+  uint32_t need = sizeof(arcCacheEntry) + size;
+  if (need > _acBudget) return nullptr;
+
+  while (_acTail && _acUsed + need > _acBudget) {
+    arcCacheEntry* e = _acTail;
+    _acTail = e->prev;
+    if (_acTail) _acTail->next = nullptr;
+    else _acHead = nullptr;
+    _acUsed -= sizeof(arcCacheEntry) + e->size;
+    free(e);
+  }
+
+  arcCacheEntry* e = nullptr;
+#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
+  if ( psramFound() ) e = (arcCacheEntry*)ps_malloc(need);
+  else
+#endif
+  e = (arcCacheEntry*)malloc(need);
+  if (!e) return nullptr;
+
+  uint16_t* row = (uint16_t*)(e + 1);
+  arcRows(r, ir, smooth, row, (uint8_t*)row + rowBytes);
+
+  e->r      = r;
+  e->ir     = ir;
+  e->smooth = smooth;
+  e->size   = size;
+  e->prev   = nullptr;
+  e->next   = _acHead;
+  if (_acHead) _acHead->prev = e;
+  else _acTail = e;
+  _acHead = e;
+  _acUsed += need;
+
+  return row;
+}
+
+
+/***************************************************************************************
+** Function name:           arcSlopeIndex
+** Description:             Count pixels of an arc row with a slope under the limit
+***************************************************************************************/
+// Pixel i of the row is at r - cx = d0 - i, with slope dy / (d0 - i) in U16.16 as in
+// drawArc(). The slope rises along the row so a binary search is used.
+static inline int32_t arcSlopeIndex(int32_t dy, int32_t d0, int32_t n, uint32_t limit)
+{
+  int32_t lo = 0, hi = n;
+  while (lo < hi) {
+    int32_t mid = (lo + hi) >> 1;
+    if ((uint32_t)(dy / (d0 - mid)) < limit) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+
+/***************************************************************************************
+** Function name:           drawArcRows (private function)
+** Description:             Draw the quadrant rows of an arc from cached coverage
+***************************************************************************************/
+// For each quadrant the pixels between the start and end slopes are a single run
+void TFT_eSPI::drawArcRows(int32_t x, int32_t y, int32_t r, const uint16_t *row,
+                           const uint32_t *startSlope, const uint32_t *endSlope,
+                           uint32_t fg_color, uint32_t bg_color)
+{
+  const uint8_t* alpha = (const uint8_t*)row + 4 * (r - 1);
+  uint8_t rev[r]; // Mirrored run for the right side quadrants
+
+  //     1 | 2
+  //    ---¦---    Slope limits of the run in each quadrant, low then high
+  //     0 | 3
+  uint32_t lim[4][2] = { { endSlope[0],   startSlope[0] }, { startSlope[1], endSlope[1] },
+                         { endSlope[2],   startSlope[2] }, { startSlope[3], endSlope[3] } };
+
+  for (int32_t cy = r - 1; cy > 0; cy--, row += 2)
+  {
+    int32_t x0 = row[0], n = row[1];
+    int32_t dy = (r - cy)<<16, d0 = r - x0;
+
+    for (uint8_t q = 0; q < 4; q++) {
+      if (!n || lim[q][1] < lim[q][0]) continue;
+      int32_t a = arcSlopeIndex(dy, d0, n, lim[q][0]);
+      int32_t b = (lim[q][1] == 0xFFFFFFFF) ? n : arcSlopeIndex(dy, d0, n, lim[q][1] + 1);
+      if (b <= a) continue;
+
+      if (q < 2) drawAlphaSpan(x + x0 + a - r, (q ? y + cy - r : y - cy + r), alpha + a, b - a, fg_color, bg_color);
+      else {
+        for (int32_t i = a; i < b; i++) rev[b - 1 - i] = alpha[i];
+        drawAlphaSpan(x - x0 - b + 1 + r, (q == 2 ? y + cy - r : y - cy + r), rev, b - a, fg_color, bg_color);
+      }
+    }
+    alpha += n;
+  }
+}
+
 /***************************************************************************************
 ** Function name:           drawSmoothCircle
 ** Description:             Draw a smooth circle
@@ -4256,10 +5085,13 @@ void TFT_eSPI::fillSmoothCircle(int32_t x, int32_t y, int32_t r, uint32_t color,
   int32_t r1 = r * r;
   r++;
   int32_t r2 = r * r;
-  
+
+  uint8_t line[2 * r + 1]; // Coverage of a line
+
   for (int32_t cy = r - 1; cy > 0; cy--)
   {
     int32_t dy2 = (r - cy) * (r - cy);
+    int32_t n = 0; // Number of anti-aliased edge pixels
     for (cx = xs; cx < r; cx++)
     {
       int32_t hyp2 = (r - cx) * (r - cx) + dy2;
@@ -4271,21 +5103,16 @@ void TFT_eSPI::fillSmoothCircle(int32_t x, int32_t y, int32_t r, uint32_t color,
       xs = cx;
       if (alpha < 9) continue;
 
-      if (bg_color == 0x00FFFFFF) {
-        drawPixel(x + cx - r, y + cy - r, color, alpha, bg_color);
-        drawPixel(x - cx + r, y + cy - r, color, alpha, bg_color);
-        drawPixel(x - cx + r, y - cy + r, color, alpha, bg_color);
-        drawPixel(x + cx - r, y - cy + r, color, alpha, bg_color);
-      }
-      else {
-        uint16_t pcol = drawPixel(x + cx - r, y + cy - r, color, alpha, bg_color);
-        drawPixel(x - cx + r, y + cy - r, pcol);
-        drawPixel(x - cx + r, y - cy + r, pcol);
-        drawPixel(x + cx - r, y - cy + r, pcol);
-      }
+      line[n++] = alpha;
     }
-    drawFastHLine(x + cx - r, y + cy - r, 2 * (r - cx) + 1, color);
-    drawFastHLine(x + cx - r, y - cy + r, 2 * (r - cx) + 1, color);
+
+    // Edge pixels precede cx, mirror them on the right side of the solid centre
+    int32_t len = 2 * (r - cx) + 1;
+    memset(line + n, 255, len);
+    for (int32_t i = 0; i < n; i++) line[n + len + i] = line[n - 1 - i];
+
+    drawAlphaSpan(x + cx - n - r, y + cy - r, line, len + 2 * n, color, bg_color);
+    drawAlphaSpan(x + cx - n - r, y - cy + r, line, len + 2 * n, color, bg_color);
   }
   inTransaction = lockTransaction;
   end_tft_write();
@@ -4337,12 +5164,14 @@ void TFT_eSPI::drawSmoothRoundRect(int32_t x, int32_t y, int32_t r, int32_t ir,
 
   uint8_t alpha = 0;
 
+  uint8_t lline[r]; // Coverage of left side quadrant line
+  uint8_t rline[r]; // Coverage of right side quadrant line, mirrored
+
   // Scan top left quadrant x y r ir fg_color  bg_color
   for (int32_t cy = r - 1; cy > 0; cy--)
   {
     int32_t len = 0;  // Pixel run length
     int32_t lxst = 0; // Left side run x start
-    int32_t rxst = 0; // Right side run x start
     int32_t dy2 = (r - cy) * (r - cy);
 
     // Find and track arc zone start point
@@ -4357,11 +5186,9 @@ void TFT_eSPI::drawSmoothRoundRect(int32_t x, int32_t y, int32_t r, int32_t ir,
       if (hyp > r2) {
         alpha = ~sqrt_fraction(hyp); // Outer AA zone
       }
-      // If within arc fill zone, get line lengths for each quadrant
+      // If within arc fill zone the pixel is fully covered
       else if (hyp >= r3) {
-        rxst = cx; // Right side start
-        len++;     // Line segment length
-        continue;  // Next x
+        alpha = 255;
       }
       else {
         if (hyp <= r4) break;  // Skip inner pixels
@@ -4370,19 +5197,20 @@ void TFT_eSPI::drawSmoothRoundRect(int32_t x, int32_t y, int32_t r, int32_t ir,
 
       if (alpha < 16) continue;  // Skip low alpha pixels
 
-      // If background is read it must be done in each quadrant - TODO
-      uint16_t pcol = fastBlend(alpha, fg_color, bg_color);
-      if (quadrants & 0x8) drawPixel(x + cx - r, y - cy + r + h, pcol);     // BL
-      if (quadrants & 0x1) drawPixel(x + cx - r, y + cy - r, pcol);         // TL
-      if (quadrants & 0x2) drawPixel(x - cx + r + w, y + cy - r, pcol);     // TR
-      if (quadrants & 0x4) drawPixel(x - cx + r + w, y - cy + r + h, pcol); // BR
+      // Outer edge, arc and inner edge pixels form one continuous line
+      if (!len) lxst = cx;
+      lline[len] = alpha;
+      rline[r - 1 - len++] = alpha;
     }
-    // Fill arc inner zone in each quadrant
-    lxst = rxst - len + 1; // Calculate line segment start for left side
-    if (quadrants & 0x8) drawFastHLine(x + lxst - r, y - cy + r + h, len, fg_color);     // BL
-    if (quadrants & 0x1) drawFastHLine(x + lxst - r, y + cy - r, len, fg_color);         // TL
-    if (quadrants & 0x2) drawFastHLine(x - rxst + r + w, y + cy - r, len, fg_color);     // TR
-    if (quadrants & 0x4) drawFastHLine(x - rxst + r + w, y - cy + r + h, len, fg_color); // BR
+
+    if (!len) continue;
+
+    // Draw the line in each quadrant
+    uint8_t *rl = rline + r - len;
+    if (quadrants & 0x8) drawAlphaSpan(x + lxst - r, y - cy + r + h, lline, len, fg_color, bg_color);               // BL
+    if (quadrants & 0x1) drawAlphaSpan(x + lxst - r, y + cy - r, lline, len, fg_color, bg_color);                   // TL
+    if (quadrants & 0x2) drawAlphaSpan(x - lxst - len + 1 + r + w, y + cy - r, rl, len, fg_color, bg_color);       // TR
+    if (quadrants & 0x4) drawAlphaSpan(x - lxst - len + 1 + r + w, y - cy + r + h, rl, len, fg_color, bg_color);   // BR
   }
 
   // Draw sides
@@ -4423,9 +5251,12 @@ void TFT_eSPI::fillSmoothRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, i
   r++;
   int32_t r2 = r * r;
 
+  uint8_t line[2 * r + 1 + (w > 0 ? w : 0)]; // Coverage of a line
+
   for (int32_t cy = r - 1; cy > 0; cy--)
   {
     int32_t dy2 = (r - cy) * (r - cy);
+    int32_t n = 0; // Number of anti-aliased edge pixels
     for (cx = xs; cx < r; cx++)
     {
       int32_t hyp2 = (r - cx) * (r - cx) + dy2;
@@ -4437,13 +5268,17 @@ void TFT_eSPI::fillSmoothRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, i
       xs = cx;
       if (alpha < 9) continue;
 
-      drawPixel(x + cx - r, y + cy - r, color, alpha, bg_color);
-      drawPixel(x - cx + r + w, y + cy - r, color, alpha, bg_color);
-      drawPixel(x - cx + r + w, y - cy + r + h, color, alpha, bg_color);
-      drawPixel(x + cx - r, y - cy + r + h, color, alpha, bg_color);
+      line[n++] = alpha;
     }
-    drawFastHLine(x + cx - r, y + cy - r, 2 * (r - cx) + 1 + w, color);
-    drawFastHLine(x + cx - r, y - cy + r + h, 2 * (r - cx) + 1 + w, color);
+
+    // Edge pixels precede cx, mirror them on the right side of the solid centre
+    int32_t len = 2 * (r - cx) + 1 + w;
+    if (len < 0) len = 0;
+    memset(line + n, 255, len);
+    for (int32_t i = 0; i < n; i++) line[n + len + i] = line[n - 1 - i];
+
+    drawAlphaSpan(x + cx - n - r, y + cy - r, line, len + 2 * n, color, bg_color);
+    drawAlphaSpan(x + cx - n - r, y - cy + r + h, line, len + 2 * n, color, bg_color);
   }
   inTransaction = lockTransaction;
   end_tft_write();
@@ -4494,17 +5329,18 @@ void TFT_eSPI::drawWedgeLine(float ax, float ay, float bx, float by, float ar, f
   float alpha = 1.0f;
   ar += 0.5;
 
-  uint16_t bg = bg_color;
   float xpax, ypay, bax = bx - ax, bay = by - ay;
 
+  uint8_t line[x1 - x0 + 1]; // Coverage of a line
+
   begin_nin_write();
   inTransaction = true;
 
   int32_t xs = x0;
   // Scan bounding box from ys down, calculate pixel intensity from distance to line
   for (int32_t yp = ys; yp <= y1; yp++) {
-    bool swin = true;  // Flag to start new window area
     bool endX = false; // Flag to skip pixels
+    int32_t n = 0;
     ypay = yp - ay;
     for (int32_t xp = xs; xp <= x1; xp++) {
       if (endX) if (alpha <= LoAlphaTheshold) break;  // Skip right side
@@ -4513,36 +5349,19 @@ void TFT_eSPI::drawWedgeLine(float ax, float ay, float bx, float by, float ar, f
       if (alpha <= LoAlphaTheshold ) continue;
       // Track edge to minimise calculations
       if (!endX) { endX = true; xs = xp; }
-      if (alpha > HiAlphaTheshold) {
-        #ifdef GC9A01_DRIVER
-          drawPixel(xp, yp, fg_color);
-        #else
-          if (swin) { setWindow(xp, yp, x1, yp); swin = false; }
-          pushColor(fg_color);
-        #endif
-        continue;
-      }
-      //Blend color with background and plot
-      if (bg_color == 0x00FFFFFF) {
-        bg = readPixel(xp, yp); swin = true;
-      }
-      #ifdef GC9A01_DRIVER
-        uint16_t pcol = fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg);
-        drawPixel(xp, yp, pcol);
-        swin = swin;
-      #else
-        if (swin) { setWindow(xp, yp, x1, yp); swin = false; }
-        pushColor(fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg));
-      #endif
+      if (alpha > HiAlphaTheshold) line[n++] = 255;
+      else line[n++] = (uint8_t)(alpha * PixelAlphaGain);
     }
+    // Blend line with background and plot
+    if (n) drawAlphaSpan(xs - _xDatum, yp - _yDatum, line, n, fg_color, bg_color);
   }
 
   // Reset x start to left side of box
   xs = x0;
   // Scan bounding box from ys-1 up, calculate pixel intensity from distance to line
   for (int32_t yp = ys-1; yp >= y0; yp--) {
-    bool swin = true;  // Flag to start new window area
     bool endX = false; // Flag to skip pixels
+    int32_t n = 0;
     ypay = yp - ay;
     for (int32_t xp = xs; xp <= x1; xp++) {
       if (endX) if (alpha <= LoAlphaTheshold) break;  // Skip right side of drawn line
@@ -4551,28 +5370,11 @@ void TFT_eSPI::drawWedgeLine(float ax, float ay, float bx, float by, float ar, f
       if (alpha <= LoAlphaTheshold ) continue;
       // Track line boundary
       if (!endX) { endX = true; xs = xp; }
-      if (alpha > HiAlphaTheshold) {
-        #ifdef GC9A01_DRIVER
-          drawPixel(xp, yp, fg_color);
-        #else
-          if (swin) { setWindow(xp, yp, x1, yp); swin = false; }
-          pushColor(fg_color);
-        #endif
-        continue;
-      }
-      //Blend colour with background and plot
-      if (bg_color == 0x00FFFFFF) {
-        bg = readPixel(xp, yp); swin = true;
-      }
-      #ifdef GC9A01_DRIVER
-        uint16_t pcol = fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg);
-        drawPixel(xp, yp, pcol);
-        swin = swin;
-      #else
-        if (swin) { setWindow(xp, yp, x1, yp); swin = false; }
-        pushColor(fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg));
-      #endif
+      if (alpha > HiAlphaTheshold) line[n++] = 255;
+      else line[n++] = (uint8_t)(alpha * PixelAlphaGain);
     }
+    // Blend line with background and plot
+    if (n) drawAlphaSpan(xs - _xDatum, yp - _yDatum, line, n, fg_color, bg_color);
   }
 
   inTransaction = lockTransaction;
@@ -4592,6 +5394,154 @@ inline float TFT_eSPI::wedgeLineDistance(float xpax, float ypay, float bax, floa
 }
 
 
+/***************************************************************************************
+** Function name:           drawSmoothLine - background colour specified or pixel read
+** Description:             draw an anti-aliased line with square ends, width wd
+***************************************************************************************/
+void TFT_eSPI::drawSmoothLine(float ax, float ay, float bx, float by, float wd, uint32_t fg_color, uint32_t bg_color)
+{
+  begin_nin_write();
+  inTransaction = true;
+
+  smoothLineSegment(ax, ay, bx, by, wd, fg_color, bg_color, true);
+
+  inTransaction = lockTransaction;
+  end_nin_write();
+}
+
+
+/***************************************************************************************
+** Function name:           drawSmoothPolyline - background colour specified or pixel read
+** Description:             draw joined anti-aliased lines through n points
+***************************************************************************************/
+void TFT_eSPI::drawSmoothPolyline(const float *x, const float *y, uint16_t n, float wd, uint32_t fg_color, uint32_t bg_color)
+{
+  if (!x || !y || !n) return;
+
+  begin_nin_write();
+  inTransaction = true;
+
+  // Each segment leaves its end pixels to the next one, repeated points are skipped
+  uint16_t a = 0;
+  for (uint16_t i = 1; i < n; i++) {
+    if ((x[i] == x[a]) && (y[i] == y[a])) continue;
+    uint16_t j = i + 1;
+    while ((j < n) && (x[j] == x[i]) && (y[j] == y[i])) j++;
+    smoothLineSegment(x[a], y[a], x[i], y[i], wd, fg_color, bg_color, j == n);
+    a = i;
+  }
+
+  // All points the same
+  if (a == 0) smoothLineSegment(x[0], y[0], x[0], y[0], wd, fg_color, bg_color, true);
+
+  inTransaction = lockTransaction;
+  end_nin_write();
+}
+
+
+/***************************************************************************************
+** Function name:           smoothLineSegment - private helper function for drawSmoothLine
+** Description:             draw an anti-aliased line, optionally without the end pixels
+***************************************************************************************/
+// The line is stepped one pixel at a time along the major axis u, and at each step covers
+// a span of the minor axis v, width 1 (Wu) or the line width scaled for the slope. Pixel
+// coverage is the overlap of that span with the pixel, found with 16.16 fixed point sums.
+// The u pixel range is half open so joined segments do not blend the shared pixels twice.
+// Each row of pixels is sent as one span.
+void TFT_eSPI::smoothLineSegment(float ax, float ay, float bx, float by, float wd, uint32_t fg_color, uint32_t bg_color, bool last)
+{
+  if (_vpOoB) return;
+  if (isnan(ax) || isnan(ay) || isnan(bx) || isnan(by)) return;
+
+  bool steep = fabsf(by - ay) > fabsf(bx - ax);
+
+  // Viewport in user coordinates, on u and v axes
+  int32_t u0 = _vpX - _xDatum, u1 = _vpW - _xDatum - 1;
+  int32_t v0 = _vpY - _yDatum, v1 = _vpH - _yDatum - 1;
+  float au = ax, av = ay, bu = bx, bv = by;
+  if (steep) {
+    transpose(u0, v0); transpose(u1, v1);
+    au = ay; av = ax; bu = by; bv = bx;
+  }
+
+  float s  = (bu != au) ? (bv - av) / (bu - au) : 0.0f;        // v step per u pixel, |s| <= 1
+  float ht = ((wd > 1.0f) ? wd * sqrtf(1.0f + s * s) : 1.0f) / 2.0f; // Half span on v axis
+
+  // u pixel range, clamped to just outside the viewport before conversion
+  int32_t ua = fminf(fmaxf(floorf(au + 0.5f), u0 - 1.0f), u1 + 1.0f);
+  int32_t ub = fminf(fmaxf(floorf(bu + 0.5f), u0 - 1.0f), u1 + 1.0f);
+  if (!last) {
+    if (ua == ub) return;
+    ub += (ub > ua) ? -1 : 1;
+  }
+  if (ua > ub) transpose(ua, ub);
+  if (ua < u0) ua = u0;
+  if (ub > u1) ub = u1;
+  if (ua > ub) return;
+
+  int32_t s16 = s * 65536.0f;
+  int32_t h16 = ht * 65536.0f;
+
+  if (!steep) {
+    // Shallow line, scan each row v that the column spans reach
+    float va = av + (ua - au) * s, vb = av + (ub - au) * s;
+    int32_t va0 = fminf(fmaxf(floorf(fminf(va, vb) - ht + 0.5f), v0), v1 + 1.0f);
+    int32_t vb0 = fminf(fmaxf(floorf(fmaxf(va, vb) + ht + 0.5f), v0 - 1.0f), v1);
+    float is = (s != 0.0f) ? 1.0f / s : 0.0f;
+
+    uint8_t line[ub - ua + 1];
+
+    for (int32_t v = va0; v <= vb0; v++) {
+      int32_t xa = ua, xb = ub;
+      if (s != 0.0f) {
+        // Columns with a span that can overlap this row
+        float ea = au + (v - 0.5f - ht - av) * is;
+        float eb = au + (v + 0.5f + ht - av) * is;
+        if (ea > eb) transpose(ea, eb);
+        if (ea > xa) xa = floorf(ea);
+        if (eb < xb) xb = ceilf(eb);
+      }
+
+      // Span centre relative to the row centre
+      int32_t d16 = (av + (xa - au) * s - v) * 65536.0f;
+      int32_t n = 0;
+      for (int32_t u = xa; u <= xb; u++, d16 += s16) {
+        int32_t hi = d16 + h16, lo = d16 - h16;
+        if (hi > 0x8000) hi = 0x8000;
+        if (lo < -0x8000) lo = -0x8000;
+        int32_t c = hi - lo;
+        if (c <= 0x800) { if (n) break; xa++; continue; } // Under 1/32 coverage
+        line[n++] = (c >= 0x10000) ? 255 : (c * 255) >> 16;
+      }
+      if (n) drawAlphaSpan(xa, v, line, n, fg_color, bg_color);
+    }
+  }
+  else {
+    // Steep line, one row per u step
+    uint8_t line[(int32_t)(2 * ht) + 3];
+
+    for (int32_t u = ua; u <= ub; u++) {
+      float c = av + (u - au) * s;
+      int32_t xa = fminf(fmaxf(floorf(c - ht + 0.5f), v0), v1 + 1.0f);
+      int32_t xb = fminf(fmaxf(floorf(c + ht + 0.5f), v0 - 1.0f), v1);
+
+      // Span ends relative to the pixel centre
+      int32_t lo16 = (c - xa) * 65536.0f - h16;
+      int32_t hi16 = lo16 + 2 * h16;
+      int32_t n = 0;
+      for (int32_t v = xa; v <= xb; v++, lo16 -= 0x10000, hi16 -= 0x10000) {
+        int32_t hi = (hi16 > 0x8000) ? 0x8000 : hi16;
+        int32_t lo = (lo16 < -0x8000) ? -0x8000 : lo16;
+        int32_t c = hi - lo;
+        if (c <= 0x800) { if (n) break; xa++; continue; }
+        line[n++] = (c >= 0x10000) ? 255 : (c * 255) >> 16;
+      }
+      if (n) drawAlphaSpan(xa, u, line, n, fg_color, bg_color);
+    }
+  }
+}
+
+
 /***************************************************************************************
 ** Function name:           drawFastVLine
 ** Description:             draw a vertical line
@@ -4846,6 +5796,215 @@ void TFT_eSPI::invertDisplay(bool i)
 }
 
 
+/***************************************************************************************
+** Function name:           setScrollArea
+** Description:             Set the area moved by scrollArea()
+***************************************************************************************/
+// The TFT scrolls frame memory lines, these are screen rows for rotation 0 and 2 and
+// columns for rotation 1 and 3. In some rotations screen positions run from the end of
+// frame memory (TFT_VSCR_REVERSE has a bit set per rotation), the fixed area before the
+// scroll area is then at the screen end. Positions in the area do not move on screen,
+// scrollPosition() gives where each one is held in the TFT after scrolling.
+bool TFT_eSPI::setScrollArea(int32_t start, int32_t size, uint32_t color)
+{
+  resetScrollArea();
+
+  _scrollRows = !(rotation & 1);
+  int32_t len = _scrollRows ? _height : _width;
+
+  if (start < 0) { size += start; start = 0; }
+  if ((start + size) > len) size = len - start;
+  if (size < 1) return false;
+
+  _scrollStart = start;
+  _scrollSize  = size;
+  _scrollColor = color;
+
+#if defined (TFT_VSCRDEF) && defined (TFT_VSCRSADD)
+  #ifdef TFT_VSCR_LINES
+  int32_t lines = TFT_VSCR_LINES;
+  #else
+  int32_t lines = _init_height;
+  #endif
+
+  if (rotation < 4) {
+    int32_t offset = 0;
+  #ifdef CGRAM_OFFSET
+    offset = _scrollRows ? rowstart : colstart;
+  #endif
+  #ifdef TFT_VSCR_REVERSE
+    _scrollRev = (TFT_VSCR_REVERSE >> rotation) & 1;
+  #else
+    _scrollRev = (rotation >= 2); // MY is set for rotations 2 and 3
+  #endif
+    _scrollTFA = _scrollRev ? lines - (offset + start + size) : offset + start;
+
+    if ((_scrollTFA >= 0) && ((_scrollTFA + size) <= lines)) {
+      writeScrollArea(_scrollTFA, size, lines - _scrollTFA - size, _scrollTFA);
+      _scrollHW = true;
+    }
+  }
+#endif
+
+  return _scrollHW;
+}
+
+
+/***************************************************************************************
+** Function name:           scrollArea
+** Description:             Scroll the area content by lines
+***************************************************************************************/
+// With hardware scrolling only the exposed lines and the start line command are sent.
+// Otherwise the lines kept are read from the TFT and written back, so the TFT must
+// support reads. Lines exposed are contiguous on screen unless they wrap at the end of
+// the area, so scrolling by a factor of the area size keeps text lines in one piece.
+int32_t TFT_eSPI::scrollArea(int32_t lines)
+{
+  if (_scrollSize < 1) return 0;
+
+  if (lines >  _scrollSize) lines =  _scrollSize;
+  if (lines < -_scrollSize) lines = -_scrollSize;
+
+  // First area position exposed
+  int32_t pos = (lines < 0) ? _scrollStart : _scrollStart + _scrollSize - lines;
+  int32_t n   = (lines < 0) ? -lines : lines;
+
+  if (n == 0) return _scrollStart;
+
+  if (_scrollHW) {
+    _scrollOff += lines;
+    if (_scrollOff >= _scrollSize) _scrollOff -= _scrollSize;
+    if (_scrollOff < 0) _scrollOff += _scrollSize;
+
+    // Lines exposed hold the content scrolled off, blank them before they are shown
+    fillScrollLines(pos, n, _scrollColor);
+
+    int32_t off = _scrollRev ? (_scrollSize - _scrollOff) % _scrollSize : _scrollOff;
+    writeScrollArea(0, 0, 0, _scrollTFA + off);
+
+    return scrollPosition(pos);
+  }
+
+  // Copy in screen coordinates
+  int32_t vp[8] = { _vpX, _vpY, _vpW, _vpH, _xDatum, _yDatum, _xWidth, _yHeight };
+  bool    vpDatum = _vpDatum, vpOoB = _vpOoB;
+  resetViewport();
+
+  int32_t  len = _scrollRows ? _width : _height;
+  uint16_t buf[len];
+
+  // Work away from the end being overwritten
+  for (int32_t i = 0; i < _scrollSize - n; i++) {
+    int32_t dst = (lines > 0) ? _scrollStart + i : _scrollStart + _scrollSize - 1 - i;
+    if (_scrollRows) { readRect(0, dst + lines, len, 1, buf); pushRect(0, dst, len, 1, buf); }
+    else             { readRect(dst + lines, 0, 1, len, buf); pushRect(dst, 0, 1, len, buf); }
+  }
+
+  _vpX = vp[0]; _vpY = vp[1]; _vpW = vp[2]; _vpH = vp[3];
+  _xDatum = vp[4]; _yDatum = vp[5]; _xWidth = vp[6]; _yHeight = vp[7];
+  _vpDatum = vpDatum; _vpOoB = vpOoB;
+
+  fillScrollLines(pos, n, _scrollColor);
+
+  return pos;
+}
+
+
+/***************************************************************************************
+** Function name:           scrollPosition
+** Description:             Return where a position of the scroll area is held in the TFT
+***************************************************************************************/
+// Positions outside the area are returned unchanged
+int32_t TFT_eSPI::scrollPosition(int32_t pos)
+{
+  int32_t p = pos - _scrollStart;
+  if ((p < 0) || (p >= _scrollSize)) return pos;
+
+  p += _scrollOff;
+  if (p >= _scrollSize) p -= _scrollSize;
+
+  return _scrollStart + p;
+}
+
+
+/***************************************************************************************
+** Function name:           resetScrollArea
+** Description:             End scrolling and show the TFT memory unscrolled
+***************************************************************************************/
+void TFT_eSPI::resetScrollArea(void)
+{
+#if defined (TFT_VSCRDEF) && defined (TFT_VSCRSADD)
+  if (_scrollHW) {
+  #ifdef TFT_VSCR_LINES
+    writeScrollArea(0, TFT_VSCR_LINES, 0, 0);
+  #else
+    writeScrollArea(0, _init_height, 0, 0);
+  #endif
+  }
+#endif
+
+  _scrollSize = 0;
+  _scrollOff  = 0;
+  _scrollHW   = false;
+}
+
+
+/***************************************************************************************
+** Function name:           writeScrollArea
+** Description:             Send the scroll area definition and start line
+***************************************************************************************/
+// A vsa of 0 sends the start line only
+void TFT_eSPI::writeScrollArea(int32_t tfa, int32_t vsa, int32_t bfa, int32_t vsp)
+{
+#if defined (TFT_VSCRDEF) && defined (TFT_VSCRSADD)
+  begin_tft_write();
+
+  if (vsa) {
+    writecommand(TFT_VSCRDEF);
+    writedata(tfa >> 8); writedata(tfa);
+    writedata(vsa >> 8); writedata(vsa);
+    writedata(bfa >> 8); writedata(bfa);
+  }
+
+  writecommand(TFT_VSCRSADD);
+  writedata(vsp >> 8); writedata(vsp);
+
+  end_tft_write();
+#endif
+}
+
+
+/***************************************************************************************
+** Function name:           fillScrollLines
+** Description:             Fill n lines of the scroll area from position pos
+***************************************************************************************/
+// Lines are filled across the screen in screen coordinates, the viewport is not used
+void TFT_eSPI::fillScrollLines(int32_t pos, int32_t n, uint32_t color)
+{
+  begin_tft_write();
+
+  while (n > 0) {
+    int32_t p   = scrollPosition(pos);
+    int32_t run = _scrollStart + _scrollSize - p; // Lines before the area end
+    if (run > n) run = n;
+
+    if (_scrollRows) {
+      setWindow(0, p, _width - 1, p + run - 1);
+      pushBlock(color, run * _width);
+    }
+    else {
+      setWindow(p, 0, p + run - 1, _height - 1);
+      pushBlock(color, run * _height);
+    }
+
+    pos += run;
+    n   -= run;
+  }
+
+  end_tft_write();
+}
+
+
 /**************************************************************************
 ** Function name:           setAttribute
 ** Description:             Sets a control parameter of an attribute
@@ -5032,6 +6191,37 @@ uint32_t TFT_eSPI::alphaBlend24(uint8_t alpha, uint32_t fgc, uint32_t bgc, uint8
   return (rxx & 0xFF0000) | (xgx & 0x00FF00) | (xxb & 0x0000FF);
 }
 
+
+/***************************************************************************************
+** Function name:           blendSpan
+** Description:             Blend colour fg into a line of n colours using alpha values
+***************************************************************************************/
+// Uses the same split multiply as fastBlend(), alpha 0 leaves the pixel unchanged and
+// alpha 255 sets it to fg without any multiplies. Colours are 565, not byte swapped.
+void TFT_eSPI::blendSpan(uint16_t *dst, uint16_t fg, const uint8_t *alpha, int32_t n)
+{
+  uint32_t fgrb = fg & 0xF81F;
+  uint32_t fgg  = fg & 0x07E0;
+
+  while (n--)
+  {
+    uint8_t a = *alpha++;
+    if (a == 255) *dst = fg;
+    else if (a)
+    {
+      // Split out and blend 5-bit red and blue channels
+      uint32_t rxb = *dst & 0xF81F;
+      rxb += (fgrb - rxb) * (a >> 2) >> 6;
+      // Split out and blend 6-bit green channel
+      uint32_t xgx = *dst & 0x07E0;
+      xgx += (fgg - xgx) * a >> 8;
+      // Recombine channels
+      *dst = (rxb & 0xF81F) | (xgx & 0x07E0);
+    }
+    dst++;
+  }
+}
+
 /***************************************************************************************
 ** Function name:           write
 ** Description:             draw characters piped through serial stream
@@ -5348,60 +6538,15 @@ int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
     begin_tft_write();
     inTransaction = true;
 
-    w *= height; // Now w is total number of pixels in the character
-    if (textcolor == textbgcolor && !clip) {
-
-      int32_t px = 0, py = pY; // To hold character block start and end column and row values
-      int32_t pc = 0; // Pixel count
-      uint8_t np = textsize * textsize; // Number of pixels in a drawn pixel
-
-      uint8_t tnp = 0; // Temporary copy of np for while loop
-      uint8_t ts = textsize - 1; // Temporary copy of textsize
-      // 16-bit pixel count so maximum font size is equivalent to 180x180 pixels in area
-      // w is total number of pixels to plot to fill character block
-      while (pc < w) {
-        line = pgm_read_byte((uint8_t *)flash_address);
-        flash_address++;
-        if (line & 0x80) {
-          line &= 0x7F;
-          line++;
-          if (ts) {
-            px = xd + textsize * (pc % width); // Keep these px and py calculations outside the loop as they are slow
-            py = yd + textsize * (pc / width);
-          }
-          else {
-            px = xd + pc % width; // Keep these px and py calculations outside the loop as they are slow
-            py = yd + pc / width;
-          }
-          while (line--) { // In this case the while(line--) is faster
-            pc++; // This is faster than putting pc+=line before while()?
-            setWindow(px, py, px + ts, py + ts);
-
-            if (ts) {
-              tnp = np;
-              while (tnp--) {tft_Write_16(textcolor);}
-            }
-            else {tft_Write_16(textcolor);}
-            px += textsize;
+    // Text colour != background and character is within viewport area so use faster
+    // drawing of characters and background using block write
+    if (textcolor != textbgcolor && !clip)
+    {
+      setWindow(xd, yd, xd + width * textsize - 1, yd + height * textsize - 1);
 
-            if (px >= (xd + width * textsize)) {
-              px = xd;
-              py += textsize;
-            }
-          }
-        }
-        else {
-          line++;
-          pc += line;
-        }
-      }
-    }
-    else {
-      // Text colour != background and textsize = 1 and character is within viewport area
-      // so use faster drawing of characters and background using block write
-      if (textcolor != textbgcolor && textsize == 1 && !clip)
+      if (textsize == 1)
       {
-        setWindow(xd, yd, xd + width - 1, yd + height - 1);
+        w *= height; // Now w is total number of pixels in the character
 
         // Maximum font size is equivalent to 180x180 pixels in area
         while (w > 0) {
@@ -5419,40 +6564,26 @@ int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
       }
       else
       {
-        int32_t px = 0, py = 0;  // To hold character pixel coords
-        int32_t tx = 0, ty = 0;  // To hold character TFT pixel coords
-        int32_t pc = 0;          // Pixel count
-        int32_t pl = 0;          // Pixel line length
-        uint16_t pcol = 0;       // Pixel color
-        bool     pf = true;      // Flag for plotting
-        while (pc < w) {
-          line = pgm_read_byte((uint8_t *)flash_address);
-          flash_address++;
-          if (line & 0x80) { pcol = textcolor; line &= 0x7F; pf = true;}
-          else { pcol = textbgcolor; if (textcolor == textbgcolor) pf = false;}
-          line++;
-          px = pc % width;
-          tx = x + textsize * px;
-          py = pc / width;
-          ty = y + textsize * py;
-
-          pl = 0;
-          pc += line;
-          while (line--) {
-            pl++;
-            if ((px+pl) >= width) {
-              if (pf) fillRect(tx, ty, pl * textsize, textsize, pcol);
-              pl = 0;
-              px = 0;
-              tx = x;
-              py ++;
-              ty += textsize;
+        // Decode a row at a time and send it textsize times as scaled runs
+        const uint8_t *rle = (const uint8_t *)flash_address;
+        uint8_t row[width];
+        uint8_t run = 0, set = 0;
+        for (int32_t i = 0; i < height; i++) {
+          rleRow(&rle, &run, &set, row, width);
+          for (uint8_t r = 0; r < textsize; r++) {
+            int32_t k = 0;
+            while (k < width) {
+              uint8_t bit = row[k];
+              int32_t k0 = k;
+              while (++k < width && row[k] == bit);
+              pushBlock(bit ? textcolor : textbgcolor, (k - k0) * textsize);
             }
           }
-          if (pl && pf) fillRect(tx, ty, pl * textsize, textsize, pcol);
         }
       }
     }
+    else drawRleRuns((const uint8_t *)flash_address, width, height, x, y, textcolor, textbgcolor, textsize);
+
     inTransaction = lockTransaction;
     end_tft_write();
   }
@@ -5507,6 +6638,7 @@ int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8
 
   int16_t sumX = 0;
   uint8_t padding = 1, baseline = 0;
+  int32_t lineX = poX, lineY = poY;          // Position before datum adjustment
   uint16_t cwidth = textWidth(string, font); // Find the pixel width of the string in the font
   uint16_t cheight = 8 * textsize;
 
@@ -5600,6 +6732,38 @@ int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8
     }
   }
 
+  // Draw the line in the line buffer if the text is opaque, the box includes padding and a
+  // margin for free and smooth font glyphs that extend outside their advance or line height
+  if (_lineBufSize && (textcolor != textbgcolor)) {
+    int32_t bx = poX, by = poY, bw = cwidth, bh = cheight, m = 0;
+#ifdef LOAD_GFXFF
+    if (freeFont) {
+      by = poY - glyph_ab * textsize;
+      bh = (glyph_ab + glyph_bb) * textsize;
+      m  = bh / 2;
+    }
+#endif
+#ifdef SMOOTH_FONT
+    // Smooth font glyph backgrounds are only filled if requested or padding is set
+    if (fontLoaded) m = (_fillbg || padX) ? bh / 2 : -1;
+#endif
+    if (padX > cwidth) {
+      switch(padding % 100) {
+        case 1:
+          bw = padX;
+          break;
+        case 2:
+          bx -= (padX - cwidth) >> 1;
+          bw += ((padX - cwidth) >> 1) * 2;
+          break;
+        case 3:
+          bx = poX + cwidth - padX;
+          bw = padX;
+          break;
+      }
+    }
+    if ((m >= 0) && drawStringLine(string, lineX, lineY, font, bx - m, by - m, bw + 2 * m, bh + 2 * m, &sumX)) return sumX;
+  }
 
   int8_t xo = 0;
 #ifdef LOAD_GFXFF
@@ -5650,6 +6814,15 @@ int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8
   else
 #endif
   {
+#ifdef LOAD_GLCD
+    // Scaled GLCD font is drawn as runs across the whole string
+  #ifdef LOAD_GFXFF
+    if (font == 1 && textsize > 1 && !gfxFont) sumX = drawGlcdString(string, poX, poY);
+  #else
+    if (font == 1 && textsize > 1) sumX = drawGlcdString(string, poX, poY);
+  #endif
+    else
+#endif
     while (n < len) {
       uint16_t uniCode = decodeUTF8((uint8_t*)string, &n, len - n);
       sumX += drawChar(uniCode, poX+sumX, poY, font);
@@ -5723,6 +6896,161 @@ return sumX;
 }
 
 
+/***************************************************************************************
+** Function name:           setTextLineBuffer
+** Description:             Set the RAM used to draw text lines before sending them
+***************************************************************************************/
+// Strings drawn with a background colour are rendered in a 16bpp Sprite strip that is
+// reused and only grows up to "bytes", then the painted area is sent in one window. With
+// dma true the line is sent with DMA when the sketch has called startWrite(). Lines that
+// do not fit, or smooth font text that may wrap, are drawn directly. 0 frees the strip.
+// The area sent is opaque, so smooth font glyph edges that overhang the filled background
+// are drawn on the background colour instead of the old screen content
+void TFT_eSPI::setTextLineBuffer(uint32_t bytes, bool dma)
+{
+  if (_lineStrip) {
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+    dmaWait(); // Strip may still be in use
+#endif
+    delete _lineStrip;
+    _lineStrip = nullptr;
+  }
+  _lineW = _lineH = 0;
+  _lineBufSize = bytes;
+  _lineDMA = dma;
+}
+
+
+/***************************************************************************************
+** Function name:           drawStringLine
+** Description:             Draw a string in the line buffer and send it to the TFT
+***************************************************************************************/
+// x, y and font are as passed to drawString(), bx, by, bw, bh is a box that contains all
+// the pixels drawn after datum adjustment. Returns false if the line buffer is not used
+bool TFT_eSPI::drawStringLine(const char *string, int32_t x, int32_t y, uint8_t font,
+                              int32_t bx, int32_t by, int32_t bw, int32_t bh, int16_t *sumX)
+{
+  // Clip the box to the viewport, in screen coordinates
+  int32_t x0 = bx + _xDatum, y0 = by + _yDatum;
+  int32_t x1 = x0 + bw,      y1 = y0 + bh;
+
+  if (x0 < _vpX) x0 = _vpX;
+  if (y0 < _vpY) y0 = _vpY;
+  if (x1 > _vpW) x1 = _vpW;
+  if (y1 > _vpH) y1 = _vpH;
+
+  int32_t w = x1 - x0, h = y1 - y0;
+
+  if ((w < 1) || (h < 1) || ((uint32_t)(w * h) * 2 > _lineBufSize)) return false;
+
+#ifdef SMOOTH_FONT
+  // drawGlyph() wraps at the TFT edges and new lines, the strip does not, and a colour
+  // callback must read the TFT
+  if (fontLoaded) {
+    if ((textwrapX && (bx + bw > width())) || (textwrapY && (by + bh >= height()))) return false;
+    if (getColor || strchr(string, '\n')) return false;
+  }
+#endif
+
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+  // Wait only if the last line is still being sent from the strip
+  if (_lineDMA && _lineStrip) dmaFence(_lineStrip->getPointer(), _lineW * _lineH * 2);
+#endif
+
+  // Grow the strip, keeping the larger of each old and new dimension if it fits
+  if ((w > _lineW) || (h > _lineH)) {
+    int32_t sw = (w > _lineW) ? w : _lineW;
+    int32_t sh = (h > _lineH) ? h : _lineH;
+    if ((uint32_t)(sw * sh) * 2 > _lineBufSize) { sw = w; sh = h; }
+
+    if (!_lineStrip) {
+      _lineStrip = new TFT_eSprite(this);
+      if (!_lineStrip) return false;
+      _lineStrip->setAttribute(PSRAM_ENABLE, false); // Internal RAM is faster and DMA capable
+    }
+    _lineStrip->deleteSprite();
+    _lineStrip->setColorDepth(16);
+    _lineW = _lineH = 0;
+    if (!_lineStrip->createSprite(sw, sh)) return false;
+    _lineStrip->setDirtyTracking(true);
+    _lineW = sw;
+    _lineH = sh;
+  }
+
+  // The strip origin is at x0, y0 so the string is drawn with the same coordinates
+  TFT_eSPI *s = _lineStrip;
+  int32_t dx = _xDatum - x0, dy = _yDatum - y0;
+  _lineStrip->setViewport(dx, dy, w - dx, h - dy, true);
+  _lineStrip->fillRect(-dx, -dy, w, h, textbgcolor);
+  _lineStrip->clearDirty();
+
+  s->textcolor   = textcolor;
+  s->textbgcolor = textbgcolor;
+  s->textsize    = textsize;
+  s->textfont    = textfont;
+  s->textdatum   = textdatum;
+  s->padX        = padX;
+  s->_fillbg     = _fillbg;
+  s->isDigits    = isDigits;
+  s->_utf8       = _utf8;
+  s->_cp437      = _cp437;
+  s->textwrapX   = false;
+  s->textwrapY   = false;
+#ifdef LOAD_GFXFF
+  s->gfxFont     = gfxFont;
+  s->glyph_ab    = glyph_ab;
+  s->glyph_bb    = glyph_bb;
+#endif
+#ifdef SMOOTH_FONT
+  s->cursor_x      = cursor_x;
+  s->cursor_y      = cursor_y;
+  s->bg_cursor_x   = bg_cursor_x;
+  s->last_cursor_x = last_cursor_x;
+  if (fontLoaded) shareFont(s, true);
+#endif
+
+  *sumX = _lineStrip->drawString(string, x, y, font);
+
+#ifdef SMOOTH_FONT
+  if (fontLoaded) shareFont(s, false);
+  cursor_x      = s->cursor_x;
+  cursor_y      = s->cursor_y;
+  bg_cursor_x   = s->bg_cursor_x;
+  last_cursor_x = s->last_cursor_x;
+#endif
+  isDigits = false; // Reset by textWidth()
+
+  int32_t px, py, pw, ph;
+  if (!_lineStrip->getDirtyBounds(&px, &py, &pw, &ph)) return true;
+  _lineStrip->clearDirty();
+
+  // Send the painted area, Sprite pixels are stored byte swapped
+  uint16_t *ptr = (uint16_t*)_lineStrip->getPointer() + px + py * _lineW;
+  bool oldSwapBytes = _swapBytes;
+  _swapBytes = false;
+
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+  if (_lineDMA && DMA_Enabled && lockTransaction) {
+    setAddrWindowDMA(x0 + px, y0 + py, pw, ph);
+    if (pw == _lineW) pushPixelsDMA(ptr, pw * ph);
+    else while (ph--) { pushPixelsDMA(ptr, pw); ptr += _lineW; }
+    _swapBytes = oldSwapBytes;
+    return true;
+  }
+  if (_lineDMA) dmaWait(); // Queued transfers must finish before the CPU uses the bus
+#endif
+
+  begin_tft_write();
+  setWindow(x0 + px, y0 + py, x0 + px + pw - 1, y0 + py + ph - 1);
+  if (pw == _lineW) pushPixels(ptr, pw * ph);
+  else while (ph--) { pushPixels(ptr, pw); ptr += _lineW; }
+  end_tft_write();
+
+  _swapBytes = oldSwapBytes;
+  return true;
+}
+
+
 /***************************************************************************************
 ** Function name:           drawCentreString (deprecated, use setTextDatum())
 ** Descriptions:            draw string centred on dX
@@ -6145,8 +7473,16 @@ void TFT_eSPI::getSetup(setup_t &tft_settings)
 
 #include "Extensions/Button.cpp"
 
+#include "Extensions/SpritePool.cpp"
+
 #include "Extensions/Sprite.cpp"
 
+#include "Extensions/Readout.cpp"
+
+#include "Extensions/Mesh3D.cpp"
+
+#include "Extensions/Q565.cpp"
+
 #ifdef SMOOTH_FONT
   #include "Extensions/Smooth_font.cpp"
 #endif
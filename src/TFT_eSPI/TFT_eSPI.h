@@ -423,8 +423,14 @@ int16_t tch_spi_freq;// Touch controller read/write SPI frequency
 // Callback prototype for smooth font pixel colour read
 typedef uint16_t (*getColorCallback)(uint16_t x, uint16_t y);
 
+class TFT_eSprite;
+class TFT_eSPI_Readout;
+class TFT_eSPI_Q565;
+
 // Class functions and variables
 class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has access to protected members
+                               friend class TFT_eSPI_Readout; // Readout restores text state and shares transactions
+                               friend class TFT_eSPI_Q565;    // Q565 shares transactions as pushImage() does
 
  //--------------------------------------- public ------------------------------------//
  public:
@@ -456,6 +462,10 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
                    // Push (aka write pixel) colours to the set window
   virtual void     pushColor(uint16_t color);
 
+                   // Read or write a line of n 565 colours (not byte swapped) at x,y, clipped to the viewport
+  virtual void     readSpan(int32_t x, int32_t y, int32_t n, uint16_t *data);
+  virtual void     writeSpan(int32_t x, int32_t y, int32_t n, uint16_t *data);
+
                    // These are non-inlined to enable override
   virtual void     begin_nin_write();
   virtual void     end_nin_write();
@@ -471,6 +481,18 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
 
   void     invertDisplay(bool i);  // Tell TFT to invert all displayed colours
 
+           // Hardware vertical scrolling. The scroll area is rows start to start + size - 1 for rotation 0
+           // and 2, or columns for rotation 1 and 3 (call again after setRotation()). Returns true if the
+           // driver scrolls the area (TFT_VSCRDEF defined), else scrollArea() copies pixels by reading the TFT
+  bool     setScrollArea(int32_t start, int32_t size, uint32_t color = TFT_BLACK);
+           // Move the area content lines toward the start (negative toward the end), the lines exposed
+           // are filled with color. Returns the row (or column) to draw the first exposed line at
+  int32_t  scrollArea(int32_t lines);
+           // Return the row (or column) where a row (or column) of the scroll area is currently drawn
+  int32_t  scrollPosition(int32_t pos);
+           // End scrolling, the TFT memory is then shown as it is held
+  void     resetScrollArea(void);
+
 
   // The TFT_eSprite class inherits the following functions (not all are useful to Sprite class
   void     setAddrWindow(int32_t xs, int32_t ys, int32_t w, int32_t h); // Note: start coordinates + width and height
@@ -533,6 +555,20 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            drawTriangle(int32_t x1,int32_t y1, int32_t x2,int32_t y2, int32_t x3,int32_t y3, uint32_t color),
            fillTriangle(int32_t x1,int32_t y1, int32_t x2,int32_t y2, int32_t x3,int32_t y3, uint32_t color);
 
+           // Draw n-1 joined lines through the n points in xs[] and ys[] in one transaction. The pixels are the
+           // same as drawLine() would draw, but each point is drawn once and lines of pixels are merged into runs
+  void     drawPolyline(const int16_t *xs, const int16_t *ys, uint16_t n, uint32_t color);
+           // Plot n values as a polyline, value i is at x = x0 + i * stepX, y = yOffset + values[i] * yScale
+           // (a negative yScale plots upwards). A NaN value leaves a gap in the line
+  void     plotSeries(const float *values, uint16_t n, int32_t x0, float stepX, float yOffset, float yScale, uint32_t color);
+
+           // Fill a polygon with n corners, which may be concave (self intersecting polygons are filled even-odd).
+           // Pixels with a centre inside are filled, so polygons that share a side neither overlap nor leave a gap
+  void     fillPolygon(const int16_t *xs, const int16_t *ys, uint16_t n, uint32_t color);
+           // Fill count triangles with the same rule as fillPolygon. vertices[] holds x,y pairs and indices[] holds
+           // 3 vertex numbers per triangle, if indices is nullptr each 3 vertices in turn make a triangle
+  void     fillTriangles(const int16_t *vertices, const uint16_t *indices, uint16_t count, uint32_t color);
+
 
   // Smooth (anti-aliased) graphics drawing
            // Draw a pixel blended with the background pixel colour (bg_color) specified,  return blended colour
@@ -550,6 +586,11 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // The sides of the arc are anti-aliased by default. If smoothArc is false sides will NOT be anti-aliased
   void     drawArc(int32_t x, int32_t y, int32_t r, int32_t ir, uint32_t startAngle, uint32_t endAngle, uint32_t fg_color, uint32_t bg_color, bool smoothArc = true);
 
+           // Keep the row coverage of arcs drawn by drawArc() and drawSmoothArc() in up to "bytes" of RAM, so gauges
+           // redrawn at the same radii only work out where the arc ends fall. 0 (the default) turns the cache off.
+           // An arc of outer radius r needs roughly 4*r bytes plus one byte per pixel of a quarter of the arc ring
+  void     setArcCache(uint32_t bytes);
+
            // Draw an anti-aliased filled circle at x, y with radius r
            // Note: The thickness of line is 3 pixels to reduce the visible "braiding" effect of anti-aliasing narrow lines
            //       this means the inner anti-alias zone is always at r-1 and the outer zone at r+1
@@ -562,6 +603,7 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // Draw a rounded rectangle that has a line thickness of r-ir+1 and bounding box defined by x,y and w,h
            // The outer corner radius is r, inner corner radius is ir
            // The inside and outside of the border are anti-aliased
+           // If bg_color is not included the background pixel colour will be read from TFT or sprite
   void     drawSmoothRoundRect(int32_t x, int32_t y, int32_t r, int32_t ir, int32_t w, int32_t h, uint32_t fg_color, uint32_t bg_color = 0x00FFFFFF, uint8_t quadrants = 0xF);
 
            // Draw a filled rounded rectangle , corner radius r and bounding box defined by x,y and w,h
@@ -579,6 +621,15 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // If bg_color is not included the background pixel colour will be read from TFT or sprite
   void     drawWedgeLine(float ax, float ay, float bx, float by, float aw, float bw, uint32_t fg_color, uint32_t bg_color = 0x00FFFFFF);
 
+           // Draw an anti-aliased line from ax,ay to bx,by width wd with square ends, a width of 1 or less gives a
+           // thin Wu style line. Fixed point scanning, so much faster than drawWideLine for charts and traces
+           // If bg_color is not included the background pixel colour will be read from TFT or sprite
+  void     drawSmoothLine(float ax, float ay, float bx, float by, float wd, uint32_t fg_color, uint32_t bg_color = 0x00FFFFFF);
+
+           // Draw n-1 joined anti-aliased lines through the n points in x[] and y[], as for drawSmoothLine
+           // Shared points are drawn once so a joint is not blended twice
+  void     drawSmoothPolyline(const float *x, const float *y, uint16_t n, float wd, uint32_t fg_color, uint32_t bg_color = 0x00FFFFFF);
+
 
   // Image rendering
            // Swap the byte order for pushImage() and pushPixels() - corrects endianness
@@ -613,11 +664,15 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
 
            // These are used by Sprite class pushSprite() member function for 1, 4 and 8 bits per pixel (bpp) colours
            // They are not intended to be used with user sketches (but could be)
-           // Set bpp8 true for 8bpp sprites, false otherwise. The cmap pointer must be specified for 4bpp
+           // Set bpp8 true for 8bpp sprites, false otherwise. The cmap pointer must be specified for 4bpp,
+           // for 8bpp it selects a 256 colour palette instead of RGB332
   void     pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t  *data, bool bpp8 = true, uint16_t *cmap = nullptr);
   void     pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t  *data, uint8_t  transparent, bool bpp8 = true, uint16_t *cmap = nullptr);
            // FLASH version
   void     pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *data, bool bpp8,  uint16_t *cmap = nullptr);
+           // Free the 1kbyte 4bpp expansion table shared by all 4bpp Sprites and images, e.g. when no more
+           // 4bpp Sprites will be pushed. It is allocated again if needed
+  void     deletePaletteLUT(void);
 
            // Render a 16-bit colour image with a 1bpp mask
   void     pushMaskedImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *img, uint8_t *mask);
@@ -669,6 +724,10 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
   void     setTextPadding(uint16_t x_width);                // Set text padding (background blanking/over-write) width in pixels
   uint16_t getTextPadding(void);                            // Get text padding
 
+           // Draw strings that have a background colour in a RAM line buffer of up to "bytes", then send
+           // each line in one window (or by DMA after startWrite()), 0 turns it off. TFT only, not Sprites
+  void     setTextLineBuffer(uint32_t bytes, bool dma = false);
+
 #ifdef LOAD_GFXFF
   void     setFreeFont(const GFXfont *f = NULL),            // Select the GFX Free Font
            setTextFont(uint8_t font);                       // Set the font number to use in future
@@ -738,6 +797,9 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
   uint16_t alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc, uint8_t dither);
            // 24-bit colour alphaBlend with optional alpha dither
   uint32_t alphaBlend24(uint8_t alpha, uint32_t fgc, uint32_t bgc, uint8_t dither = 0);
+           // Blend colour fg into a line of n colours at dst using alpha[] values, 0 leaves the
+           // colour unchanged and 255 sets fg. Use with readSpan() and writeSpan() to blend a line.
+  void     blendSpan(uint16_t *dst, uint16_t fg, const uint8_t *alpha, int32_t n);
 
   // Direct Memory Access (DMA) support functions
   // These can be used for SPI writes when using the ESP32 (original) or STM32 processors.
@@ -781,19 +843,28 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // image buffer content will be altered to a correctly clipped image before DMA is initiated.
            //
            // The function will wait for the last DMA to complete if it is called while a previous DMA is still
-           // in progress, this simplifies the sketch and helps avoid "gotchas".
+           // in progress, this simplifies the sketch and helps avoid "gotchas". On ESP32 SPI, if DMA_QUEUE_SIZE is
+           // defined greater than 1 in the setup file, the window and image are queued behind earlier transfers
+           // (up to DMA_QUEUE_SIZE pushes) and the function only waits if the buffer it must change is still
+           // being sent. The sketch must then use dmaFence() before it changes an image that was sent.
   void     pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer = nullptr);
 
 #if defined (ESP32) // ESP32 only at the moment
            // For case where pointer is a const and the image data must not be modified (clipped or byte swapped)
   void     pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t const* data);
 #endif
-           // Push a block of pixels into a window set up using setAddrWindow()
+           // Push a block of pixels into a window set up using setAddrWindowDMA() or setAddrWindow()
   void     pushPixelsDMA(uint16_t* image, uint32_t len);
+           // Set the window for pushPixelsDMA(). On ESP32 SPI the window commands are queued with DMA after
+           // earlier transfers, elsewhere this waits for the DMA to complete then calls setAddrWindow()
+  void     setAddrWindowDMA(int32_t x, int32_t y, int32_t w, int32_t h);
 
            // Check if the DMA is complete - use while(tft.dmaBusy); for a blocking wait
   bool     dmaBusy(void); // returns true if DMA is still in progress
   void     dmaWait(void); // wait until DMA is complete
+           // Wait only until len bytes of memory at buffer are no longer being sent, e.g. before a buffer
+           // that was pushed with DMA is reused. Where one transfer is in progress at a time this is dmaWait()
+  void     dmaFence(const void* buffer, uint32_t len = 1);
 
   bool     DMA_Enabled = false;   // Flag for DMA enabled state
   uint8_t  spiBusyCheck = 0;      // Number of ESP32 transfer buffers to check
@@ -879,6 +950,58 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // Helper function: calculate distance of a point from a finite length line between two points
   float    wedgeLineDistance(float pax, float pay, float bax, float bay, float dr);
 
+           // Helper function: draw one drawSmoothLine segment, the pixels at bx,by are only drawn if last is true
+  void     smoothLineSegment(float ax, float ay, float bx, float by, float wd, uint32_t fg_color, uint32_t bg_color, bool last);
+
+           // Helper function: find the quadrant row coverage of an arc, returns the number of alpha values. If
+           // row is not nullptr the start x and pixel count of each row are stored, if alpha is not nullptr the values
+  uint32_t arcRows(int32_t r, int32_t ir, bool smooth, uint16_t *row, uint8_t *alpha);
+           // Helper function: return the cached row coverage of an arc, building it if needed, nullptr if not cached
+  const uint16_t* cachedArc(int32_t r, int32_t ir, bool smooth);
+           // Helper function: draw the quadrant rows of an arc from cached coverage, r is the outer AA zone radius
+  void     drawArcRows(int32_t x, int32_t y, int32_t r, const uint16_t *row, const uint32_t *startSlope, const uint32_t *endSlope,
+                       uint32_t fg_color, uint32_t bg_color);
+
+           // Helper functions: a line of pixels being built by drawPolyline() and plotSeries(), runs are added
+           // and merged with it if they continue the same row or column, or else it is drawn first (len 0 = flush)
+  typedef struct { int32_t x, y, len; bool v; } lineRun;
+  void     addLineRun(lineRun *run, int32_t x, int32_t y, int32_t len, bool vertical, uint32_t color);
+           // Add the drawLine() runs of a line to run, the x0,y0 pixel is left out unless first is true
+  void     polylineSegment(lineRun *run, int32_t x0, int32_t y0, int32_t x1, int32_t y1, bool first, uint32_t color);
+
+           // Helper functions: polygon edge for fillPolygon() and fillTriangles(), rows y0 to y1 - 1 are crossed.
+           // The first pixel on or right of the crossing of the current row is x + (r > 0), r is a remainder of
+           // d and dx, dr are the changes per row, so the crossings are exact
+  typedef struct { int32_t x, r, dx, dr, d, y0, y1; } polyEdge;
+  bool     setPolyEdge(polyEdge *e, int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+           // Fill between pairs of active edges for each row, act[] is work space for n edge numbers
+  void     fillPolyEdges(polyEdge *e, uint16_t *act, uint16_t n, uint32_t color);
+
+           // Helper function: draw a line of n pixels of colour with coverage alpha[], blended with bg_color
+           // or the existing pixels if bg_color is 0x00FFFFFF
+  void     drawAlphaSpan(int32_t x, int32_t y, const uint8_t *alpha, int32_t n, uint32_t color, uint32_t bg_color);
+
+           // Return 4bpp byte to 2 pixel expansion table for colour map cmap (nullptr if no memory)
+  uint32_t* paletteLUT(uint16_t *cmap);
+           // Expand lines of a 4bpp (table lut) or 1bpp (lut = nullptr) image and push to the set window
+  void     pushPaletteLines(const uint8_t *data, int32_t w, int32_t dx, int32_t dy, int32_t dw, int32_t dh,
+                            uint32_t *lut, bool flash);
+
+           // Draw GLCD font columns as horizontal runs of scaled pixels
+  void     drawGlcdRuns(const uint8_t *column, int32_t n, int32_t x, int32_t y, uint32_t color, uint32_t bg, uint8_t size);
+           // Draw a string in the scaled GLCD font with runs merged across characters
+  int16_t  drawGlcdString(const char *string, int32_t x, int32_t y);
+           // Draw a run length encoded font character as merged runs of scaled pixels
+  void     drawRleRuns(const uint8_t *rle, int32_t width, int32_t height, int32_t x, int32_t y, uint32_t color, uint32_t bg, uint8_t size);
+           // Draw a string in the line buffer Sprite, bx,by,bw,bh encloses the aligned text and padding
+  bool     drawStringLine(const char *string, int32_t x, int32_t y, uint8_t font,
+                          int32_t bx, int32_t by, int32_t bw, int32_t bh, int16_t *sumX);
+
+           // Send the scroll area definition and start line commands
+  void     writeScrollArea(int32_t tfa, int32_t vsa, int32_t bfa, int32_t vsp);
+           // Fill n lines of the scroll area from position pos with color, at their current TFT positions
+  void     fillScrollLines(int32_t pos, int32_t n, uint32_t color);
+
            // Display variant settings
   uint8_t  tabcolor,                   // ST7735 screen protector "tab" colour (now invalid)
            colstart = 0, rowstart = 0; // Screen display area to CGRAM area coordinate offsets
@@ -898,6 +1021,41 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
 
   //uint32_t lastColor = 0xFFFF; // Last colour - used to minimise bit shifting overhead
 
+           // 4bpp palette expansion table, 1kbyte allocated when first needed, kept until deletePaletteLUT()
+  uint32_t *_lut4 = nullptr;
+  uint16_t _lut4Map[16];       // Colour map the table was built from
+  bool     _lut4Valid = false;
+
+           // Text line buffer, see setTextLineBuffer()
+  TFT_eSprite *_lineStrip = nullptr;
+  uint32_t _lineBufSize = 0;
+  int32_t  _lineW = 0, _lineH = 0;   // Strip Sprite size
+  bool     _lineDMA = false;
+
+           // Scroll area, see setScrollArea(). Positions are rows, or columns if _scrollRows is false
+  int32_t  _scrollStart = 0, _scrollSize = 0;
+  int32_t  _scrollOff = 0;     // Area position shown at the area start, 0 to _scrollSize - 1
+  int32_t  _scrollTFA = 0;     // TFT memory line of the area start for hardware scrolling
+  uint32_t _scrollColor = TFT_BLACK;
+  bool     _scrollRows = true;
+  bool     _scrollRev  = false; // Screen positions run in the opposite direction to TFT memory lines
+  bool     _scrollHW   = false;
+
+           // Arc coverage cache, entries are in a list from most to least recently used
+  typedef struct arcCacheEntry
+  {
+    struct arcCacheEntry* prev;      // More recently used entry
+    struct arcCacheEntry* next;      // Less recently used entry
+    int16_t  r, ir;                  // Arc radii
+    bool     smooth;                 // Anti-aliased sides
+    uint32_t size;                   // Row table and alpha bytes, these follow the entry
+  } arcCacheEntry;
+
+  arcCacheEntry* _acHead = nullptr;  // Most recently used
+  arcCacheEntry* _acTail = nullptr;  // Least recently used, evicted first
+  uint32_t _acBudget = 0;            // Cache size limit in bytes, 0 = no cache
+  uint32_t _acUsed   = 0;            // Bytes allocated including entry headers
+
   getColorCallback getColor = nullptr; // Smooth font callback function pointer
 
   bool     locked, inTransaction, lockTransaction; // SPI transaction and mutex lock flags
@@ -1005,7 +1163,19 @@ fastBlend(A alpha, F fgc, B bgc)
 // Load the Button Class
 #include "Extensions/Button.h"
 
+// Load the Sprite memory pool Class
+#include "Extensions/SpritePool.h"
+
 // Load the Sprite Class
 #include "Extensions/Sprite.h"
 
+// Load the numeric Readout Class
+#include "Extensions/Readout.h"
+
+// Load the 3D mesh renderer Class
+#include "Extensions/Mesh3D.h"
+
+// Load the Q565 compressed image decoder Class
+#include "Extensions/Q565.h"
+
 #endif // ends #ifndef _TFT_eSPIH_
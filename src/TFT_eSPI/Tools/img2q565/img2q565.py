@@ -0,0 +1,288 @@
+'''
+
+    This script converts an image to the Q565 compressed RGB565 format and
+    outputs a C header file with a byte array for the TFT_eSPI_Q565 decoder.
+
+    You'll need python 3.6 or later. BMP files (1 to 32 bits per pixel, not
+    run-length encoded) are read directly, other image formats are read
+    with Pillow if it is installed. C arrays of 16-bit RGB565 values, as used
+    by pushImage(), can be converted by giving the image width.
+
+    usage: python img2q565.py [-v] image.bmp [-o image.h] [-n name]
+           python img2q565.py [-v] Alert.h -w 32 [-a alert] [-o alert_q565.h]
+
+    Format (all values big endian):
+
+        "Q565", width (2 bytes), height (2 bytes), then pixel operations
+        for the rows top to bottom. The previous pixel starts as black and
+        64 recently seen colours are held in a table indexed by a hash.
+
+        00iiiiii                 colour from table entry i
+        01rrggbb                 previous colour, red, green and blue changed
+                                 by -2 to +1
+        10gggggg rrrrbbbb        previous colour, green changed by -32 to +31
+                                 (g - 32), red and blue changed by that / 2
+                                 plus -8 to +7 (r - 8, b - 8)
+        11nnnnnn                 previous colour repeated n + 1 times (1 to 62)
+        11111110 cccc            colour c
+        11111111 nnnn            previous colour repeated n + 63 times
+
+    Changes wrap around, so a red of 31 changed by +1 is 0.
+
+'''
+
+import sys
+import struct
+import argparse
+import os
+import re
+
+debug = None
+
+def debugOut(s):
+    if debug:
+        print(s)
+
+OP_INDEX = 0x00
+OP_DIFF  = 0x40
+OP_LUMA  = 0x80
+OP_RUN   = 0xC0
+OP_RGB   = 0xFE
+OP_LONG  = 0xFF
+
+MAX_RUN  = 62
+MAX_LONG = 65535 + 63
+
+
+def q565_hash(c):
+    return ((c >> 11) * 3 + ((c >> 5) & 0x3F) * 5 + (c & 0x1F) * 7) & 0x3F
+
+
+def wrap(v, bits):
+    # Signed value of v in the given number of bits
+    m = 1 << bits
+    v &= m - 1
+    return v - m if v >= (m >> 1) else v
+
+
+def encode(pixels, width, height):
+    out = bytearray(b'Q565')
+    out += struct.pack('>HH', width, height)
+
+    index = [0] * 64
+    prev = 0
+    run = 0
+
+    def flush(run):
+        if run >= 63:
+            out.append(OP_LONG)
+            out.extend(struct.pack('>H', run - 63))
+        elif run:
+            out.append(OP_RUN | (run - 1))
+
+    for c in pixels:
+        if c == prev:
+            run += 1
+            if run == MAX_LONG:
+                flush(run)
+                run = 0
+            continue
+
+        flush(run)
+        run = 0
+
+        h = q565_hash(c)
+        if index[h] == c:
+            out.append(OP_INDEX | h)
+        else:
+            index[h] = c
+            dr = wrap((c >> 11) - (prev >> 11), 5)
+            dg = wrap(((c >> 5) & 0x3F) - ((prev >> 5) & 0x3F), 6)
+            db = wrap((c & 0x1F) - (prev & 0x1F), 5)
+            vr = wrap(dr - (dg >> 1), 5)
+            vb = wrap(db - (dg >> 1), 5)
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+            elif -8 <= vr <= 7 and -8 <= vb <= 7:
+                out.append(OP_LUMA | (dg + 32))
+                out.append((vr + 8) << 4 | (vb + 8))
+            else:
+                out.append(OP_RGB)
+                out.extend(struct.pack('>H', c))
+        prev = c
+
+    flush(run)
+    return bytes(out)
+
+
+def decode(data):
+    # Reference decoder, used to check the output
+    if data[:4] != b'Q565':
+        raise ValueError('not a Q565 image')
+    width, height = struct.unpack('>HH', data[4:8])
+    pixels = []
+    index = [0] * 64
+    prev = 0
+    p = 8
+    while len(pixels) < width * height:
+        b = data[p]
+        p += 1
+        if b < OP_DIFF:
+            c = index[b]
+        elif b < OP_LUMA:
+            r = ((prev >> 11) + ((b >> 4) & 3) - 2) & 0x1F
+            g = (((prev >> 5) & 0x3F) + ((b >> 2) & 3) - 2) & 0x3F
+            bl = ((prev & 0x1F) + (b & 3) - 2) & 0x1F
+            c = r << 11 | g << 5 | bl
+        elif b < OP_RUN:
+            dg = (b & 0x3F) - 32
+            b2 = data[p]
+            p += 1
+            r = ((prev >> 11) + (dg >> 1) + (b2 >> 4) - 8) & 0x1F
+            g = (((prev >> 5) & 0x3F) + dg) & 0x3F
+            bl = ((prev & 0x1F) + (dg >> 1) + (b2 & 0x0F) - 8) & 0x1F
+            c = r << 11 | g << 5 | bl
+        elif b == OP_RGB:
+            c = data[p] << 8 | data[p + 1]
+            p += 2
+        else:
+            if b == OP_LONG:
+                n = (data[p] << 8 | data[p + 1]) + 63
+                p += 2
+            else:
+                n = (b & 0x3F) + 1
+            pixels.extend([prev] * n)
+            continue
+        index[q565_hash(c)] = c
+        pixels.append(c)
+        prev = c
+    return pixels[:width * height], width, height
+
+
+def rgb565(r, g, b):
+    return (r & 0xF8) << 8 | (g & 0xFC) << 3 | b >> 3
+
+
+def read_bmp(name):
+    with open(name, 'rb') as f:
+        data = f.read()
+    if data[:2] != b'BM':
+        return None
+    offset = struct.unpack_from('<I', data, 10)[0]
+    width, height, planes, bpp, compression = struct.unpack_from('<iiHHI', data, 18)
+    debugOut('BMP {} x {}, {} bits per pixel, compression {}'.format(width, height, bpp, compression))
+    if bpp not in (1, 4, 8, 16, 24, 32) or compression not in (0, 3):
+        print('BMP files with run-length encoding can not be read')
+        sys.exit(1)
+    palette = []
+    if bpp <= 8:
+        header = struct.unpack_from('<I', data, 14)[0]
+        colors = struct.unpack_from('<I', data, 46)[0] or (1 << bpp)
+        for i in range(colors):
+            p = 14 + header + 4 * i
+            palette.append(rgb565(data[p + 2], data[p + 1], data[p]))
+    bottom_up = height > 0
+    height = abs(height)
+    stride = ((width * bpp + 31) // 32) * 4
+    pixels = []
+    for y in range(height):
+        row = offset + stride * ((height - 1 - y) if bottom_up else y)
+        for x in range(width):
+            if bpp <= 8:
+                bits = x * bpp
+                i = (data[row + bits // 8] >> (8 - bpp - bits % 8)) & ((1 << bpp) - 1)
+                pixels.append(palette[i])
+            elif bpp == 16:
+                c = struct.unpack_from('<H', data, row + 2 * x)[0]
+                if compression == 0:  # 555
+                    c = (c & 0x7FE0) << 1 | (c & 0x0200) >> 4 | (c & 0x1F)
+                pixels.append(c)
+            else:
+                p = row + x * bpp // 8
+                pixels.append(rgb565(data[p + 2], data[p + 1], data[p]))
+    return pixels, width, height
+
+
+def read_pillow(name):
+    try:
+        from PIL import Image
+    except ImportError:
+        print('Pillow is needed to read {}, or convert it to a BMP file'.format(name))
+        sys.exit(1)
+    img = Image.open(name).convert('RGB')
+    width, height = img.size
+    return [rgb565(r, g, b) for r, g, b in img.getdata()], width, height
+
+
+def read_array(name, array, width, swap):
+    with open(name) as f:
+        text = f.read()
+    # Remove comments
+    text = re.sub(r'//[^\n]*|/\*.*?\*/', '', text, flags=re.S)
+    found = None
+    for m in re.finditer(r'(?:uint16_t|unsigned\s+short)\s+(\w+)\s*\[[^\]]*\]\s*(?:PROGMEM)?\s*=\s*\{([^}]*)\}', text):
+        if array is None or m.group(1) == array:
+            found = m
+            break
+    if found is None:
+        print('No 16-bit array {}found in {}'.format('"' + array + '" ' if array else '', name))
+        sys.exit(1)
+    values = [int(v, 0) & 0xFFFF for v in found.group(2).replace('\n', ' ').split(',') if v.strip()]
+    if swap:
+        values = [(v >> 8 | v << 8) & 0xFFFF for v in values]
+    if not width or len(values) % width:
+        print('The width must be given and divide the {} values of array "{}"'.format(len(values), found.group(1)))
+        sys.exit(1)
+    return values, width, len(values) // width, found.group(1)
+
+
+# look at arguments
+parser = argparse.ArgumentParser(description="Convert an image to a Q565 C array")
+parser.add_argument("-v", "--verbose", help="debug output", action="store_true")
+parser.add_argument("input", help="input file name, an image or a C file with a 16-bit array")
+parser.add_argument("-o", "--output", help="output file name")
+parser.add_argument("-n", "--name", help="array name")
+parser.add_argument("-w", "--width", help="image width, for C arrays", type=int)
+parser.add_argument("-a", "--array", help="name of the C array to convert, default is the first")
+parser.add_argument("-s", "--swap", help="C array values are byte swapped", action="store_true")
+args = parser.parse_args()
+
+if not os.path.exists(args.input):
+    parser.print_help()
+    print("The input file {} does not exist".format(args.input))
+    sys.exit(1)
+
+debug = args.verbose
+
+base = os.path.splitext(os.path.basename(args.input))[0]
+ext = os.path.splitext(args.input)[1].lower()
+
+if ext in ('.h', '.c', '.cpp'):
+    pixels, width, height, base = read_array(args.input, args.array, args.width, args.swap)
+else:
+    image = read_bmp(args.input)
+    pixels, width, height = image if image else read_pillow(args.input)
+
+name = args.name if args.name else re.sub(r'\W', '_', base) + '_q565'
+output = args.output if args.output else name + '.h'
+
+data = encode(pixels, width, height)
+
+if decode(data)[0] != pixels:
+    print('Internal error, the image does not decode to the original pixels')
+    sys.exit(1)
+
+raw = width * height * 2
+print('{} x {} pixels, {} bytes as RGB565, {} bytes as Q565 ({:.1f}:1)'.format(
+      width, height, raw, len(data), raw / len(data)))
+
+with open(output, 'w') as f:
+    f.write('// {} made by img2q565.py from {}, {} x {} pixels\n'.format(
+            os.path.basename(output), os.path.basename(args.input), width, height))
+    f.write('// {} bytes as RGB565, {} bytes as Q565\n\n'.format(raw, len(data)))
+    f.write('const uint8_t {}[{}] PROGMEM = {{\n'.format(name, len(data)))
+    for i in range(0, len(data), 16):
+        f.write(''.join('0x{:02X},'.format(b) for b in data[i:i + 16]) + '\n')
+    f.write('};\n')
+
+debugOut('Written {}'.format(output))
@@ -0,0 +1,79 @@
+/*
+ This sketch draws the icons of the TFT_Flash_Bitmap example from Q565
+ compressed arrays in program (FLASH) memory, which are less than half
+ the size of the RGB565 arrays.
+
+ The arrays were made from the Alert.h, Close.h and Info.h files with the
+ img2q565.py script in the library Tools folder, for example:
+
+   python img2q565.py Alert.h -w 32 -a alert -n alert_q565
+
+ Works with TFT_eSPI library here:
+ https://github.com/Bodmer/TFT_eSPI
+
+ #########################################################################
+ ###### DON'T FORGET TO UPDATE THE User_Setup.h FILE IN THE LIBRARY ######
+ #########################################################################
+*/
+
+#include <TFT_eSPI.h>       // Hardware-specific library
+
+TFT_eSPI      tft  = TFT_eSPI();       // Invoke custom library
+TFT_eSPI_Q565 q565 = TFT_eSPI_Q565();  // Q565 image decoder
+
+// Include the header files that contain the icons
+#include "alert_q565.h"
+#include "closeX_q565.h"
+#include "info_q565.h"
+
+long count = 0; // Loop count
+
+// Draw a Q565 image, returns false if the array is not a Q565 image
+bool drawIcon(const uint8_t *image, uint32_t len, int32_t x, int32_t y)
+{
+  if (!q565.begin(image, len)) return false;
+  return q565.drawImage(&tft, x, y);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  tft.begin();
+  tft.setRotation(1);	// landscape
+
+  tft.fillScreen(TFT_BLACK);
+
+  // Draw the icons
+  drawIcon(info_q565,   sizeof(info_q565),   100, 100);
+  drawIcon(alert_q565,  sizeof(alert_q565),  140, 100);
+  drawIcon(closeX_q565, sizeof(closeX_q565), 180, 100);
+
+  // Time 300 icons
+  uint32_t t = micros();
+  for (int i = 0; i < 100; i++) {
+    drawIcon(info_q565,   sizeof(info_q565),   100, 140);
+    drawIcon(alert_q565,  sizeof(alert_q565),  140, 140);
+    drawIcon(closeX_q565, sizeof(closeX_q565), 180, 140);
+  }
+  t = micros() - t;
+  Serial.print("Microseconds per icon: "); Serial.println(t / 300);
+
+  // Pause here to admire the icons!
+  delay(2000);
+}
+
+void loop()
+{
+  // Loop filling and clearing screen, the icons are 32 x 32
+  drawIcon(info_q565,   sizeof(info_q565),   random(tft.width() - 32), random(tft.height() - 32));
+  drawIcon(alert_q565,  sizeof(alert_q565),  random(tft.width() - 32), random(tft.height() - 32));
+  drawIcon(closeX_q565, sizeof(closeX_q565), random(tft.width() - 32), random(tft.height() - 32));
+
+  // Clear screen after 1000 x 3 = 3000 icons drawn
+  if (1000 == count++) {
+    count = 1;
+    tft.setRotation(2 * random(2)); // Rotate randomly to clear display left>right or right>left to reduce monotony!
+    tft.fillScreen(TFT_BLACK);
+    tft.setRotation(1);
+  }
+}
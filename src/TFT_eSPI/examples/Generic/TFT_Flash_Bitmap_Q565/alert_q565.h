@@ -0,0 +1,62 @@
+// alert_q565.h made by img2q565.py from ../TFT_Flash_Bitmap/Alert.h, 32 x 32 pixels
+// 2048 bytes as RGB565, 906 bytes as Q565
+
+const uint8_t alert_q565[906] PROGMEM = {
+0x51,0x35,0x36,0x35,0x00,0x20,0x00,0x20,0xCF,0xA2,0x87,0x00,0xDA,0xA4,0x86,0xFE,
+0xAC,0x66,0xAC,0xA4,0xA4,0x87,0x93,0x8C,0xFE,0x29,0x01,0x00,0xD8,0xFE,0xBC,0xC6,
+0xAD,0xA4,0xC0,0xA0,0x8A,0x14,0x3A,0xFE,0x18,0xA1,0x00,0xD6,0xFE,0x83,0x44,0xB8,
+0xB0,0xA2,0x7B,0xFE,0xFF,0xDD,0xA1,0x8A,0xFE,0xFE,0xF0,0x0F,0x91,0x7E,0x00,0xD5,
+0xA4,0x96,0xFE,0xED,0xC7,0x0F,0xFE,0xFF,0x99,0xA1,0x8B,0x65,0xA1,0x8A,0x22,0x0F,
+0xFE,0x5A,0x23,0x00,0xD4,0xFE,0x9B,0xE5,0xB2,0xB2,0xA5,0x6E,0x12,0x60,0x6E,0x06,
+0x9D,0xA4,0x0A,0x94,0x6C,0x00,0xD3,0xAB,0xA5,0x0A,0xC0,0x3F,0x65,0x3F,0x06,0x3F,
+0x19,0xFE,0xFE,0x6B,0x0A,0xFE,0x72,0xE3,0x00,0xD2,0xFE,0xB4,0x65,0x0A,0xA6,0x5F,
+0x3A,0x33,0x3A,0x3F,0x3A,0xC0,0x68,0x0A,0x9A,0x7A,0xFE,0x08,0x60,0x00,0xD0,0xB1,
+0xB2,0xFE,0xFE,0x07,0xA1,0x8A,0x06,0x9D,0xA6,0x6F,0x33,0xC1,0x27,0x06,0xFE,0xFE,
+0xAE,0x3E,0x8D,0x5F,0x00,0xD0,0xFE,0xC4,0xA5,0x3E,0xFE,0xFF,0x15,0x1B,0x69,0x8F,
+0x7C,0x83,0x7B,0xC0,0x84,0xA5,0x1B,0xC0,0x33,0xFE,0xFE,0x07,0xC0,0xFE,0x29,0x01,
+0x00,0xCE,0xFE,0x7B,0x03,0xB7,0xD1,0xA3,0x7B,0x33,0x9C,0xA5,0x08,0x92,0x6C,0x80,
+0x7B,0xC0,0x88,0xA4,0xA6,0x96,0x08,0x27,0x9C,0xA3,0x39,0x92,0x5D,0x00,0xCD,0xA2,
+0x87,0xFE,0xDD,0x26,0x39,0xFE,0xFF,0x57,0x9C,0xA6,0x69,0x3C,0x95,0x6D,0xBD,0x7B,
+0xC0,0x8A,0xA4,0xA5,0xA5,0x30,0xC0,0xA5,0x6D,0xFE,0xFE,0x08,0x39,0xFE,0x49,0xA2,
+0x00,0xCC,0xFE,0x9B,0xA4,0xB1,0xC2,0xA5,0x6E,0x14,0x9B,0xB5,0x6F,0x30,0x96,0x6C,
+0x15,0xC0,0x8A,0xB4,0x30,0x65,0x1D,0xA2,0x79,0xC0,0x2D,0x94,0x6D,0x00,0xCB,0xAA,
+0x94,0xFE,0xF5,0xC6,0x6B,0x27,0x11,0x65,0x6E,0x1D,0x98,0x6D,0xBB,0x6D,0xC0,0x8D,
+0xC2,0x1D,0x11,0x0A,0x11,0x27,0xFE,0xFE,0x0A,0x9E,0x85,0xFE,0x72,0xA3,0x00,0xCA,
+0xFE,0xAB,0xE4,0xAE,0xA3,0x1D,0x30,0x9C,0xA5,0x3E,0x05,0x11,0x9B,0x6D,0xB8,0x5D,
+0xC0,0x8F,0xD2,0x11,0x05,0xC0,0x3E,0xA1,0x8B,0x14,0x25,0x98,0x7B,0x00,0xC9,0xB0,
+0xA2,0x25,0x31,0xFE,0xFF,0x58,0x98,0xC1,0xC1,0x39,0x05,0x9D,0x6C,0xB6,0x5F,0xC0,
+0x30,0x05,0x3E,0x39,0x32,0xC0,0x0F,0x99,0xC2,0x25,0x8E,0x5E,0x00,0xC8,0xFE,0xBC,
+0x44,0xAA,0xA4,0x30,0x05,0x26,0xC0,0x6B,0x32,0x39,0x9F,0x6B,0xFE,0x10,0xA2,0x10,
+0xFE,0xFE,0xD1,0x9C,0xA7,0x32,0xC0,0x66,0x26,0x32,0x1B,0xFE,0xF5,0x86,0x19,0xFE,
+0x28,0xE1,0x00,0xC6,0xB4,0xC0,0xB7,0xD0,0xA4,0x6B,0x0F,0x98,0xC1,0xC1,0x26,0xC0,
+0x32,0xA1,0x7B,0xFE,0x10,0x82,0xA5,0x98,0xFE,0xFE,0xB0,0x2D,0x26,0xC1,0x1A,0xC0,
+0x24,0x05,0x14,0x91,0x6E,0x00,0xC5,0x0D,0xFE,0xD4,0xC4,0x14,0xFE,0xFE,0xF5,0x99,
+0xC3,0x9F,0x96,0x6B,0x13,0x1A,0xC0,0x26,0x0A,0xFE,0x08,0x61,0xA8,0x87,0x0A,0x26,
+0x1A,0xC1,0x13,0x0E,0x1A,0x1B,0x20,0x14,0xFE,0x41,0x81,0x00,0xC4,0xFE,0x93,0x43,
+0xB0,0xC2,0xA6,0x5C,0x30,0x98,0xC1,0xC0,0x6B,0x07,0x0E,0xC0,0x1A,0xA4,0x69,0x19,
+0xA9,0x97,0xFE,0xFE,0x6D,0x1A,0x13,0x0E,0xC0,0x07,0x02,0xC0,0xA4,0x6B,0x24,0x0F,
+0x95,0x6C,0x00,0xC3,0xA7,0xA5,0xFE,0xF5,0x44,0x0F,0xFE,0xFF,0x17,0x3B,0x65,0xC0,
+0x3B,0xC0,0x02,0xC0,0x07,0xA4,0x69,0xFE,0x10,0xA2,0xA9,0x96,0xFE,0xFE,0x4C,0x0E,
+0x07,0x02,0xC0,0x3B,0xC0,0x2F,0x6B,0xFE,0xFF,0x16,0x94,0xD0,0x08,0xFE,0x62,0x22,
+0x00,0xC2,0x1D,0xAD,0xC3,0xA9,0x4E,0x39,0x9A,0xB3,0xC0,0x6B,0x2F,0xC0,0x6B,0x3B,
+0xC0,0xA3,0x79,0x92,0x4E,0xA4,0x87,0x18,0x02,0x3B,0xC0,0x36,0x2F,0xC0,0x66,0x23,
+0x0E,0xA7,0x5E,0x03,0x99,0x6B,0x00,0xC1,0xAE,0xB2,0xFE,0xF5,0x04,0xA2,0x79,0x0F,
+0x14,0x7A,0xC0,0x23,0xC1,0x2F,0xC1,0xA2,0x78,0xA4,0x68,0x66,0x00,0x2F,0xC2,0x23,
+0xC1,0x17,0xC0,0x24,0x99,0xB4,0x3E,0x8F,0x4F,0xFE,0x00,0x00,0xC0,0xFE,0xB3,0xA2,
+0xAB,0xA4,0xFE,0xFE,0x92,0x02,0x9C,0x94,0x08,0x7A,0x17,0xC1,0x23,0xC1,0x2F,0x6E,
+0xC0,0x2F,0x23,0xC2,0x17,0xC1,0x0B,0x08,0x23,0xFE,0xFE,0xF5,0xFE,0xED,0x03,0x52,
+0xFE,0x18,0x80,0xAE,0xC2,0xB5,0xD0,0xA4,0x7A,0x30,0xFE,0xF5,0x23,0xC1,0x01,0x08,
+0xC0,0x17,0xC2,0x9C,0x5B,0xFE,0x39,0xC5,0x66,0x3B,0x23,0x17,0xC2,0x08,0xC0,0x01,
+0x3C,0xC0,0xA8,0x5F,0x50,0x2F,0x93,0x5E,0xA8,0xB5,0x2F,0xFE,0xFE,0xD4,0x14,0x9D,
+0xA7,0xC0,0x6E,0x3C,0xC0,0x01,0x08,0xC1,0x17,0x90,0x2F,0xFE,0x18,0xC3,0xC0,0xFE,
+0x83,0x44,0xB2,0xE0,0x61,0x08,0xC1,0x01,0x66,0xC0,0x35,0x30,0x3C,0x03,0xFE,0xED,
+0x04,0x2F,0x66,0xA7,0x6D,0x05,0x95,0xD0,0x66,0x29,0x30,0xC0,0x35,0xC0,0x3C,0xC1,
+0xA3,0x88,0x9C,0x3A,0xFE,0x20,0xE1,0x5A,0xFE,0xC4,0xE4,0x15,0x01,0x3C,0xC1,0x35,
+0xC0,0x30,0xC0,0x29,0xC0,0x02,0xA3,0x6D,0x2A,0x69,0x1F,0x3C,0x9E,0x96,0xC0,0x24,
+0xC0,0x29,0xC0,0x30,0xC0,0x35,0xC0,0x01,0xA5,0x76,0xA6,0x57,0x59,0x9B,0xCB,0x01,
+0x35,0xC1,0x30,0xC0,0x69,0xC0,0x24,0xC0,0x69,0x24,0x37,0x23,0x66,0x19,0x1D,0x66,
+0x1D,0xC1,0x24,0xC0,0x29,0xC1,0x30,0xC0,0xA2,0x77,0xA3,0x87,0xC0,0x3A,0x30,0xC1,
+0x29,0xC1,0x24,0xC0,0x1D,0xC1,0x18,0xA7,0x5E,0x1E,0xC1,0x23,0x79,0xC6,0x24,0x6B,
+0xC7,0x24,0x1F,0xC5,0x23,0x2A,0x1E,0x91,0x4F,0xAE,0xD2,0xDC,0x94,0x4D,0x00,0xA4,
+0x96,0xA9,0xB4,0xA8,0xB5,0xD8,0x9A,0x6A,0x32,0x00,
+};
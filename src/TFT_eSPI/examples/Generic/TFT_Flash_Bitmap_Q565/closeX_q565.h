@@ -0,0 +1,67 @@
+// closeX_q565.h made by img2q565.py from ../TFT_Flash_Bitmap/Close.h, 32 x 32 pixels
+// 2048 bytes as RGB565, 992 bytes as Q565
+
+const uint8_t closeX_q565[992] PROGMEM = {
+0x51,0x35,0x36,0x35,0x00,0x20,0x00,0x20,0xCC,0xA6,0xB8,0xA3,0x98,0xA5,0xA9,0xC0,
+0x21,0x41,0x00,0xD5,0xA7,0xE8,0xAB,0xE9,0xAA,0xC8,0xA9,0x68,0xA3,0x79,0xA3,0x78,
+0x6F,0x9D,0xA8,0x61,0x98,0xA8,0x95,0x59,0x94,0x38,0x00,0xD0,0xFE,0x58,0xE3,0xFE,
+0xC2,0x28,0xAF,0x89,0x36,0xA7,0x59,0xA2,0x78,0x6E,0x6F,0xC2,0x06,0x07,0x97,0xD9,
+0x92,0x88,0x94,0x18,0x00,0xCC,0xA2,0xB8,0xFE,0x89,0x45,0xB0,0xD8,0x36,0xA4,0x68,
+0x07,0x66,0xC0,0x13,0xA2,0x78,0x6E,0xC0,0x18,0xC0,0x24,0x29,0x07,0x91,0xF9,0x8F,
+0x48,0x1D,0x00,0xC9,0xA4,0xE8,0xFE,0xE2,0x08,0xB0,0x28,0x36,0x9B,0xB9,0x9B,0xB8,
+0x61,0x21,0xA4,0x68,0x31,0x07,0x18,0x07,0x31,0x0F,0x3E,0x03,0xA4,0x68,0x07,0x96,
+0xD8,0x90,0xE8,0xFE,0x40,0xA2,0x00,0xC7,0xA3,0xE8,0xFE,0xE1,0xE7,0xB3,0x19,0x0F,
+0x96,0xD8,0x98,0xC8,0xC0,0xA5,0x68,0xA6,0x58,0x03,0xA6,0x58,0x18,0x35,0x18,0x36,
+0x03,0x10,0x9B,0xB9,0x1D,0x10,0xA9,0x49,0x03,0x1C,0xFE,0x40,0x82,0x00,0xC5,0xA1,
+0xA8,0xFE,0xD9,0x86,0xB5,0x18,0x32,0xFE,0xFA,0x28,0x98,0xC8,0xA2,0x78,0xA9,0x49,
+0x29,0x10,0x3E,0x31,0xA3,0x78,0x18,0x07,0x31,0x3E,0x03,0x21,0x2A,0x9D,0xA9,0xA6,
+0x58,0x3E,0x2F,0x8C,0xF8,0x0B,0x00,0xC4,0xFE,0x78,0xA2,0xB6,0xB8,0x32,0xFE,0xF9,
+0xC7,0x95,0xE8,0xA2,0x78,0xAB,0x39,0xFE,0xFE,0xDB,0x02,0xFE,0xFB,0x4D,0x2D,0x0F,
+0x31,0x36,0x31,0x0F,0x6E,0xFE,0xFF,0x7D,0xC0,0xFE,0xFB,0x2C,0xFE,0xF9,0x45,0x9D,
+0xA8,0xA8,0x48,0xFE,0xFC,0x30,0x05,0x8A,0x58,0x00,0xC3,0xA2,0xE8,0xFE,0xD9,0xE7,
+0xB5,0x19,0xFE,0xF2,0x08,0x92,0xF8,0x71,0xAA,0x38,0x17,0xAB,0x38,0xC0,0xFE,0xFD,
+0x75,0xFE,0xFB,0x8E,0x2D,0x3E,0x03,0x3E,0x14,0x0F,0x31,0xC0,0x9A,0xB8,0xFE,0xFA,
+0x8A,0xFE,0xF8,0x82,0x61,0x25,0xFE,0xFC,0x92,0x8C,0xE8,0x26,0x00,0xC2,0xFE,0x88,
+0xA2,0xB9,0x89,0x99,0xD8,0xFE,0xF0,0x61,0x9D,0xA9,0x15,0xFE,0xFE,0x79,0x31,0xC2,
+0xFE,0xFD,0x75,0x3A,0x10,0xC0,0x03,0xFE,0xFF,0x7D,0x31,0xC2,0x98,0xC8,0x2A,0x1D,
+0x30,0xFE,0xF2,0xEB,0x1B,0x87,0xA9,0x00,0xC1,0xA1,0xD8,0xFE,0xD1,0xC7,0xB2,0x38,
+0xFE,0xE9,0x45,0x96,0xD8,0x7A,0x94,0xF8,0x31,0xC4,0x36,0xFE,0xFA,0xEB,0xA7,0x59,
+0xFE,0xFF,0x5D,0x31,0xC4,0x99,0xC9,0xFE,0xF9,0x86,0x1A,0xAA,0x38,0x2A,0x8F,0xD8,
+0x14,0x00,0xC0,0xFE,0x68,0x41,0xB7,0xB8,0x9D,0xC9,0xFE,0xE0,0x41,0x71,0x1A,0x2D,
+0x31,0xC5,0xFE,0xFD,0x14,0x39,0xA7,0x58,0xC5,0x1C,0xFE,0xF0,0x82,0x1A,0xA2,0x68,
+0x12,0xA4,0x58,0x89,0x68,0xFE,0x00,0x00,0xC0,0xFE,0x98,0x61,0xBB,0x49,0xFE,0xE1,
+0x86,0x94,0xE8,0x17,0xC0,0x2F,0xFE,0xFE,0xDB,0xA9,0x48,0xCC,0xFE,0xFB,0x8E,0x1A,
+0xC0,0x17,0xC0,0xAC,0x28,0x16,0x86,0xC8,0x00,0x7A,0xFE,0xB8,0xA2,0xB8,0x18,0xFE,
+0xD8,0xA2,0x9B,0xB9,0x14,0x17,0xC0,0x2F,0x2D,0x31,0xCA,0x0B,0x1A,0xC0,0x17,0xC0,
+0x14,0xA5,0x68,0xFE,0xEB,0xAE,0x89,0xF9,0x03,0xA0,0xA8,0xFE,0xC1,0x24,0xAF,0x59,
+0xFE,0xD0,0x20,0x76,0x14,0xC0,0x17,0xC0,0x2F,0x28,0x31,0xC8,0x0B,0x1A,0xC0,0x17,
+0xC0,0x14,0xC0,0x5E,0x20,0x91,0xC8,0x09,0xA0,0xA8,0xFE,0xC1,0x65,0xAA,0x68,0xFE,
+0xC8,0x00,0x7A,0x7A,0x14,0xC0,0x17,0xC0,0xA9,0x58,0xFE,0xFE,0x79,0x31,0xC6,0xFE,
+0xFB,0x6D,0x1A,0xC0,0x17,0xC0,0x14,0xC0,0x11,0x0E,0x00,0x22,0x0F,0x5A,0xFE,0xB9,
+0x24,0xAA,0x68,0xFE,0xC8,0x00,0x7A,0xC0,0x11,0x14,0xC0,0x17,0xA9,0x48,0x2D,0x31,
+0xC6,0xFE,0xF3,0x6D,0x17,0xC1,0x14,0xC0,0x11,0x0E,0xC0,0xB3,0x08,0x97,0xA9,0x0F,
+0xA0,0x58,0xFE,0xB0,0xA2,0xAF,0x59,0xFE,0xC0,0x00,0x0B,0x0E,0xC0,0x11,0xC0,0xAB,
+0x48,0x2D,0x31,0xC8,0xFE,0xF3,0xAE,0x14,0xC0,0x11,0xC0,0x0E,0xC0,0x0B,0x38,0x92,
+0xC8,0x06,0x4A,0xFE,0xA8,0x00,0xB5,0x38,0xFE,0xB8,0x00,0x08,0x0B,0xC0,0x0E,0xAB,
+0x48,0x2D,0x31,0xCA,0x0A,0x11,0xC0,0x0E,0x0B,0xC0,0x08,0x3D,0x8C,0xE8,0x00,0xC0,
+0xFE,0x80,0x00,0xB3,0x88,0x8F,0xF9,0x05,0x08,0x0B,0xAC,0x38,0x2D,0x31,0xCC,0xFE,
+0xEB,0xCF,0x0E,0x0B,0xC0,0x08,0xA2,0x78,0x29,0x30,0x00,0xC0,0xFE,0x48,0x00,0xFE,
+0xC1,0xC7,0x99,0xB8,0x05,0xC0,0x08,0xFE,0xF6,0x9A,0x31,0xC5,0xFE,0xEB,0xEF,0xB4,
+0x08,0x31,0xC5,0xFE,0xE4,0x10,0xFE,0xC8,0x41,0x08,0x05,0xA7,0x68,0x3F,0x92,0x08,
+0xFE,0x00,0x00,0xC0,0x06,0xFE,0xB0,0x61,0xAC,0x48,0x91,0xE9,0xC0,0x05,0x2C,0xFE,
+0xFF,0xBE,0x31,0xC3,0xFE,0xE3,0x8E,0x0E,0x2B,0x14,0x31,0xC4,0xFE,0xDB,0x0C,0xFE,
+0xC0,0x20,0x05,0x5A,0x04,0x18,0x06,0x00,0xC1,0xFE,0x60,0x00,0xAE,0xC8,0x18,0x02,
+0xC0,0x05,0xB2,0x18,0xFE,0xFF,0x9E,0x31,0xC1,0xFE,0xE3,0x8E,0xFE,0xC8,0x00,0xC1,
+0x34,0x14,0x31,0xC2,0x1D,0x05,0xC0,0x5A,0x18,0x3F,0x92,0x38,0x00,0xC2,0x09,0xFE,
+0xB0,0x41,0xAA,0x48,0x94,0xC8,0xC0,0x02,0xC0,0xB2,0x28,0xFE,0xFF,0x7D,0x31,0xFE,
+0xDB,0x8E,0x08,0xC3,0xAC,0x38,0xFE,0xF6,0xDB,0xA9,0x58,0xC0,0xFE,0xD3,0x0C,0x05,
+0x02,0xC0,0x5A,0x2B,0x13,0x09,0x00,0xC3,0xFE,0x58,0x00,0xFE,0xB0,0xE3,0x56,0x3F,
+0xC1,0x02,0xB6,0x08,0xA6,0x68,0x02,0x05,0xC4,0xAA,0x48,0x25,0xFE,0xD3,0x4D,0x02,
+0xC0,0x3F,0xC0,0xA6,0x68,0x3A,0x21,0x00,0xC5,0xFE,0x60,0x00,0xA9,0xE8,0x9B,0xA9,
+0x9C,0x98,0x3F,0xC2,0x02,0xC7,0x3F,0xC2,0x21,0x0B,0x24,0x00,0xC7,0x24,0xA8,0xE8,
+0x21,0x3C,0xC1,0x3F,0xC9,0x3C,0xC0,0x21,0x06,0x24,0x00,0xC9,0x24,0xFE,0xB0,0xA2,
+0x32,0x9B,0xA8,0x3C,0xCA,0x01,0x32,0x29,0x24,0x00,0xCB,0xFE,0x48,0x00,0x3F,0x35,
+0x45,0x9B,0xA9,0xC2,0x3C,0xC1,0x39,0xC1,0x1E,0x3A,0x3F,0x1B,0x00,0xCE,0xFE,0x58,
+0x00,0x3F,0x29,0xA2,0x68,0x23,0x9D,0xA9,0x39,0xC0,0x0D,0x23,0x37,0x29,0x3F,0x21,
+0x00,0xD2,0xA0,0xE8,0x24,0xA0,0xD8,0x3C,0x3F,0xC0,0x3C,0x33,0x24,0x12,0x00,0xE9,
+};
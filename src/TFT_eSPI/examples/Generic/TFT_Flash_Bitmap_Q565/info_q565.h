@@ -0,0 +1,63 @@
+// info_q565.h made by img2q565.py from ../TFT_Flash_Bitmap/Info.h, 32 x 32 pixels
+// 2048 bytes as RGB565, 914 bytes as Q565
+
+const uint8_t info_q565[914] PROGMEM = {
+0x51,0x35,0x36,0x35,0x00,0x20,0x00,0x20,0xEA,0xA3,0x88,0xB0,0x88,0xB0,0x88,0xA5,
+0x99,0xA7,0x88,0xC0,0x10,0x19,0x39,0x90,0x88,0x00,0xD2,0xAF,0x88,0xB8,0x88,0xB4,
+0x88,0x7F,0xA2,0x88,0xC4,0x18,0x09,0x01,0x11,0x00,0xCE,0xAB,0x88,0xB9,0x99,0x18,
+0x2C,0x6E,0xC8,0x2C,0x18,0x28,0x29,0x00,0xCB,0xB8,0x88,0x09,0x2C,0x31,0xC1,0x9B,
+0x6B,0x9B,0x7B,0x9D,0x7A,0x56,0xC0,0x0C,0x24,0x09,0x31,0xC1,0x2C,0x9D,0x88,0x30,
+0x00,0xC9,0xBD,0x88,0x09,0x2C,0x31,0x2C,0x98,0x4C,0x97,0x5D,0xC0,0x6E,0xC3,0x27,
+0x56,0x7D,0xA8,0xC5,0xA9,0xC4,0x31,0x2C,0x09,0x1D,0x00,0xC7,0x30,0x09,0x31,0xC0,
+0x9C,0x7A,0x20,0x56,0x1F,0x7E,0x6E,0xC0,0x7E,0x2C,0xC0,0x27,0x1F,0x18,0x56,0x20,
+0xAE,0xD2,0x31,0xC0,0x09,0x30,0x00,0xC5,0xAD,0x88,0x8D,0x99,0xA4,0x88,0x31,0x99,
+0x6B,0x10,0xC0,0x18,0x1F,0x27,0x6E,0xA2,0x97,0xA6,0xB5,0x7E,0x98,0x5C,0x9E,0x69,
+0x1F,0x18,0x10,0x56,0x69,0x35,0x31,0x66,0x04,0x3D,0x00,0xC4,0x85,0x88,0xB8,0x88,
+0x31,0x9B,0x7A,0x01,0xC0,0x10,0xC0,0x18,0x24,0x1F,0xB1,0xF0,0x31,0xC0,0x21,0x1F,
+0x18,0x10,0xC0,0x01,0x66,0xC0,0x05,0x31,0x1D,0x2D,0x00,0xC3,0xB1,0x88,0x09,0x31,
+0x52,0xFE,0x6D,0x5D,0x3C,0x01,0x7B,0x10,0x18,0xC0,0xA2,0x98,0x31,0xC2,0x90,0x2F,
+0x10,0xC0,0x0B,0x01,0x3C,0x56,0x04,0x24,0x31,0x09,0x25,0x00,0xC2,0x89,0x88,0x2C,
+0xC0,0x94,0x3C,0x34,0xC0,0x3C,0x08,0x10,0xC1,0x9D,0x9A,0x14,0x31,0xC0,0x24,0xFE,
+0x5C,0xFE,0x10,0xC0,0x08,0x3C,0x34,0xC0,0x55,0x01,0x2C,0xC0,0x15,0x00,0xC1,0xA7,
+0x88,0x93,0x99,0x31,0x9D,0x89,0xFE,0x5C,0xFC,0x25,0x34,0x6E,0x3C,0x08,0x10,0xC0,
+0x52,0x7A,0xAA,0xC3,0xA2,0x87,0x95,0x5E,0x9E,0x69,0x0B,0x08,0x3C,0x39,0x34,0x25,
+0x66,0x25,0x15,0x31,0x04,0x01,0x00,0xC0,0xB8,0x88,0x09,0x2C,0x96,0x4B,0x20,0x25,
+0x28,0x34,0x3C,0xC0,0x08,0x0B,0x08,0x36,0x9D,0x89,0x66,0xA3,0x87,0x03,0x08,0x3C,
+0xC0,0x34,0x28,0x25,0x20,0x56,0x11,0x2C,0x09,0x30,0x00,0xC0,0x2D,0x1D,0x2C,0x8F,
+0x2E,0x18,0x20,0x25,0x7B,0x34,0x39,0x3C,0x6E,0x3C,0xA5,0xA7,0xA9,0xC4,0xC0,0x96,
+0x5D,0x3C,0xC0,0x39,0x34,0x2F,0x25,0x20,0x18,0x69,0x15,0x2C,0x1D,0x88,0x88,0x00,
+0xC0,0x8D,0x88,0x2C,0x1D,0xFE,0x65,0x1C,0x11,0x18,0x20,0x25,0x7A,0x34,0xC0,0x3C,
+0x34,0xFE,0xE7,0x7E,0x2C,0xC0,0x41,0x2F,0x34,0xC0,0x28,0x25,0x20,0x18,0x11,0x56,
+0xA4,0xA6,0x1D,0x2C,0x3D,0x00,0xC0,0x91,0x88,0x2C,0x1D,0xFE,0x54,0xDB,0x09,0x11,
+0x18,0x20,0x6E,0xC0,0x34,0xC0,0xA3,0xB7,0x1D,0xC2,0x0F,0x2F,0x25,0xC0,0x20,0x18,
+0x11,0x09,0x66,0xA2,0x97,0x1D,0x2C,0x93,0x88,0x00,0xC0,0x25,0x2C,0x51,0x11,0x09,
+0xC0,0x11,0x6B,0x20,0xC0,0x6E,0x20,0xA3,0xB7,0x1D,0xC2,0x3B,0x20,0xC1,0x18,0x11,
+0x09,0xC0,0x56,0xA1,0xA8,0xFE,0xF7,0x9E,0x2C,0x93,0x88,0x00,0xC0,0x3D,0x2C,0x1D,
+0xFE,0x5C,0xFB,0x01,0x04,0x09,0x11,0x6B,0xC0,0x6E,0x18,0xA3,0xB7,0xB5,0xF0,0xC2,
+0xFE,0x6C,0xFC,0x18,0xC1,0x11,0x09,0x04,0x01,0x65,0x19,0x1D,0x2C,0x3D,0x00,0xC0,
+0x2D,0x1D,0xC0,0x8D,0x2F,0x35,0x01,0x04,0x09,0xC0,0x11,0xC0,0x0C,0xA3,0xB7,0xB5,
+0xF1,0xC2,0xFE,0x64,0xFB,0x09,0x11,0x09,0xC0,0x04,0x01,0x35,0xC0,0xA7,0xC6,0x1D,
+0xC0,0x89,0x99,0x00,0xC0,0xBA,0x88,0x81,0x88,0x1D,0x93,0x5D,0x35,0xC0,0x01,0x7A,
+0xC0,0x6E,0xC0,0x04,0xA3,0xB7,0x18,0xC2,0x1F,0x04,0x09,0x04,0xC0,0x01,0x35,0xC0,
+0x56,0x30,0x1D,0x51,0xBF,0x99,0x00,0xC0,0xA9,0x88,0x8F,0x99,0x2C,0x9B,0x79,0x35,
+0x2D,0x35,0xC0,0x01,0xC0,0x7A,0x56,0xA3,0xC6,0x18,0xC2,0x13,0x3C,0x01,0xC0,0x35,
+0xC0,0x2D,0xC1,0x39,0x2C,0x30,0x15,0x00,0xC1,0x8B,0x88,0x1D,0x18,0x90,0x2D,0x2D,
+0xC0,0x6E,0x35,0xC2,0xA2,0xB7,0xB7,0xF0,0xC2,0x0B,0x9D,0x6A,0x35,0xC0,0x32,0x2D,
+0xC0,0x66,0xAC,0xC3,0x18,0x1D,0x29,0x00,0xC2,0xB4,0x88,0x84,0x88,0x2C,0x39,0x35,
+0x2D,0xC2,0x35,0x2D,0xA1,0xB8,0xFE,0xEF,0x7D,0xC2,0xFE,0x4C,0x59,0x2D,0xC3,0x28,
+0x35,0x39,0x2C,0x30,0x08,0x00,0xC3,0x86,0x88,0x18,0x1D,0x96,0x6B,0x8D,0x1F,0x28,
+0xC0,0x2D,0xC0,0x28,0x9C,0x99,0xFE,0xC6,0x9C,0x09,0xC0,0x9B,0x8A,0xFE,0x23,0x98,
+0x28,0x2D,0x28,0xC0,0x59,0xC0,0x08,0x1D,0x18,0x3C,0xBA,0x88,0xC4,0xAF,0x88,0x87,
+0x99,0x2C,0x18,0x93,0x4C,0x1E,0xC0,0x6B,0x28,0xC0,0x9D,0x99,0x9D,0xA8,0xA8,0xB6,
+0xA3,0x97,0x94,0x4C,0x0F,0x28,0x25,0x1E,0xC1,0x21,0x18,0x2C,0x1C,0x11,0x00,0xC5,
+0xB9,0x88,0xBE,0x88,0x2C,0x09,0x97,0x6C,0x8F,0x2E,0x42,0x1E,0xC0,0x19,0x9D,0x99,
+0x52,0x65,0x00,0x19,0x1E,0x19,0xC0,0xA2,0x87,0xFE,0xB6,0x5C,0x09,0x2C,0x21,0x35,
+0x87,0x99,0xC7,0xBD,0x88,0x21,0xA6,0x88,0x18,0x9C,0x78,0x92,0x3D,0x19,0xC2,0x56,
+0xC0,0x19,0xC2,0x35,0x2D,0x18,0x1D,0x21,0x86,0x88,0x00,0xC9,0xB9,0x88,0x1C,0x18,
+0x2C,0x09,0x9C,0x79,0x98,0x5B,0x97,0x5C,0x42,0x9C,0x79,0xC0,0x05,0x15,0xA9,0xC5,
+0x25,0x09,0x2C,0x18,0x1C,0x35,0x00,0xCB,0xB0,0x88,0xB5,0x88,0xB2,0x88,0xA6,0x88,
+0x2C,0x1D,0x18,0x09,0x66,0xC0,0x09,0x18,0x1D,0x2C,0x1D,0x21,0x2D,0x20,0x00,0xCE,
+0xB4,0x88,0xB5,0x88,0x1C,0xA3,0x88,0x18,0x1D,0xC2,0x18,0x35,0x1C,0x15,0x08,0x00,
+0xD2,0xA6,0x88,0xB1,0x88,0xAC,0x88,0xA7,0x99,0xA4,0x88,0xC0,0x24,0x19,0x21,0x3C,
+0x00,0xE9,
+};
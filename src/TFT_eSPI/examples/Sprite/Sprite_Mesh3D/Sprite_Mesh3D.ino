@@ -0,0 +1,105 @@
+/*
+  Sketch to show a rotating 3D model drawn with the TFT_eSPI_Mesh3D class.
+
+  A water tank is built as a cylinder of triangles, faces below the water
+  level are blue. The model is drawn into a 16-bit Sprite with a depth
+  buffer, then the Sprite is pushed to the screen.
+
+  The Sprite needs 2 * 128 * 128 bytes and the depth buffer the same again.
+  If there is no memory for the depth buffer the faces are sorted instead.
+
+  Example for library:
+  https://github.com/Bodmer/TFT_eSPI
+*/
+
+#include <TFT_eSPI.h>
+
+TFT_eSPI        tft  = TFT_eSPI();
+TFT_eSprite     spr  = TFT_eSprite(&tft);
+TFT_eSPI_Mesh3D mesh = TFT_eSPI_Mesh3D();
+
+#define SIDES 16      // Faces around the tank
+#define RADIUS 30
+#define HEIGHT 70
+
+// Ring of vertices at the top and bottom plus the two centres
+int16_t  vertices[(2 * SIDES + 2) * 3];
+// Side faces (2 per side) plus the top and bottom faces
+uint16_t faces[4 * SIDES * 3];
+uint16_t colors[4 * SIDES];
+
+void buildTank(void)
+{
+  for (int i = 0; i < SIDES; i++) {
+    float a = i * 2 * PI / SIDES;
+    int16_t x = RADIUS * cos(a), z = RADIUS * sin(a);
+    int16_t *top = vertices + 3 * i, *bot = vertices + 3 * (i + SIDES);
+    top[0] = x; top[1] =  HEIGHT / 2; top[2] = z;
+    bot[0] = x; bot[1] = -HEIGHT / 2; bot[2] = z;
+  }
+  int16_t *c = vertices + 6 * SIDES;
+  c[0] = 0; c[1] =  HEIGHT / 2; c[2] = 0;
+  c[3] = 0; c[4] = -HEIGHT / 2; c[5] = 0;
+
+  // Faces are anticlockwise seen from outside the tank
+  uint16_t *f = faces;
+  for (int i = 0; i < SIDES; i++) {
+    uint16_t t0 = i, t1 = (i + 1) % SIDES, b0 = t0 + SIDES, b1 = t1 + SIDES;
+    *f++ = t0; *f++ = b0; *f++ = t1;
+    *f++ = t1; *f++ = b0; *f++ = b1;
+    *f++ = t0; *f++ = t1; *f++ = 2 * SIDES;
+    *f++ = b0; *f++ = 2 * SIDES + 1; *f++ = b1;
+  }
+}
+
+// Colour the side faces below the level blue
+void setLevel(float level)
+{
+  for (int i = 0; i < SIDES; i++) {
+    colors[4 * i]     = (level > 0.5) ? TFT_BLUE : TFT_SILVER; // Upper half of the side
+    colors[4 * i + 1] = (level > 0.0) ? TFT_BLUE : TFT_SILVER;
+    colors[4 * i + 2] = (level >= 1.0) ? TFT_BLUE : TFT_SILVER; // Top
+    colors[4 * i + 3] = TFT_SILVER;                              // Bottom
+  }
+}
+
+void setup(void)
+{
+  Serial.begin(115200);
+
+  tft.init();
+  tft.fillScreen(TFT_BLACK);
+
+  spr.setColorDepth(16);
+  spr.createSprite(128, 128);
+
+  mesh.begin(&spr);
+  mesh.setProjection(64, 64, 150, 200);
+  mesh.setShading(MESH_FLAT);
+
+  buildTank();
+
+  Serial.print("Depth buffer: ");
+  Serial.println(mesh.hasDepthBuffer() ? "yes" : "no, faces are sorted");
+}
+
+void loop()
+{
+  static float angle = 0;
+  static uint32_t frames = 0, startTime = millis();
+
+  setLevel(0.5 + 0.5 * sin(angle * 0.01));
+
+  mesh.setRotation(20, angle, 0);
+  mesh.clear(TFT_BLACK);
+  mesh.draw(vertices, 2 * SIDES + 2, faces, 4 * SIDES, colors);
+  spr.pushSprite((tft.width() - 128) / 2, (tft.height() - 128) / 2);
+
+  angle += 2;
+
+  if (++frames == 100) {
+    Serial.print(100000.0 / (millis() - startTime)); Serial.println(" fps");
+    frames = 0;
+    startTime = millis();
+  }
+}
@@ -0,0 +1,87 @@
+/*
+
+  Sketch to time the Sprite fill functions at each colour depth.
+
+  Example for library:
+  https://github.com/Bodmer/TFT_eSPI
+
+  fillSprite(), fillRect(), drawFastHLine() and drawFastVLine()
+  are timed for 16, 8, 4 and 1 bit per pixel Sprites. Odd
+  sizes and positions are used for fillRect() so the unaligned
+  start and end pixels are included in the timings.
+
+  Results are sent to the Serial Monitor in microseconds per
+  call. Nothing is drawn on the TFT except a progress message.
+
+*/
+
+// Width and height of sprite
+#define WIDTH  240
+#define HEIGHT 135
+
+// Number of calls timed for each test
+#define LOOPS  100
+
+#include <TFT_eSPI.h>                 // Include the graphics library (this includes the sprite functions)
+
+TFT_eSPI    tft = TFT_eSPI();         // Declare object "tft"
+
+TFT_eSprite spr = TFT_eSprite(&tft);  // Declare Sprite object "spr" with pointer to "tft" object
+
+void setup()
+{
+  Serial.begin(250000);
+  Serial.println();
+
+  tft.init();
+  tft.fillScreen(TFT_BLACK);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.drawString("Sprite fill benchmark, see Serial Monitor", 0, 0, 2);
+}
+
+// Print the average time per call since start time t
+void report(const char *label, uint32_t t)
+{
+  t = (micros() - t) / LOOPS;
+  Serial.print(label);
+  Serial.print(t);
+}
+
+void loop(void)
+{
+  const int8_t depth[] = { 16, 8, 4, 1 };
+
+  for (uint8_t d = 0; d < 4; d++)
+  {
+    spr.setColorDepth(depth[d]);
+    if (spr.createSprite(WIDTH, HEIGHT) == nullptr)
+    {
+      Serial.print(depth[d]); Serial.println(" bpp: not enough memory");
+      continue;
+    }
+
+    Serial.print(depth[d]); Serial.print(" bpp:");
+
+    uint32_t t = micros();
+    for (uint16_t i = 0; i < LOOPS; i++) spr.fillSprite(i & 1 ? TFT_RED : TFT_BLUE);
+    report(" fillSprite ", t);
+
+    t = micros();
+    for (uint16_t i = 0; i < LOOPS; i++) spr.fillRect(3, 1, WIDTH - 6, HEIGHT - 3, i & 1 ? TFT_GREEN : TFT_YELLOW);
+    report(", fillRect ", t);
+
+    t = micros();
+    for (uint16_t i = 0; i < LOOPS; i++) spr.drawFastHLine(1, i % HEIGHT, WIDTH - 2, i);
+    report(", drawFastHLine ", t);
+
+    t = micros();
+    for (uint16_t i = 0; i < LOOPS; i++) spr.drawFastVLine(i % WIDTH, 1, HEIGHT - 2, i);
+    report(", drawFastVLine ", t);
+    Serial.println(" us");
+
+    spr.deleteSprite();
+  }
+
+  Serial.println();
+  delay(5000);
+}
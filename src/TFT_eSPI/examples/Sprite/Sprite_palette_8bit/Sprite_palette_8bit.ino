@@ -0,0 +1,83 @@
+/*
+  Sketch to show an 8-bit Sprite with a custom 256 colour palette.
+
+  8-bit Sprites normally hold RGB332 colours, which cannot show many
+  colours closely (e.g. aquamarine 0x7FFA is shown as 0x6FFF). With a
+  palette each pixel is an index to any of 256 RGB565 colours. Here the
+  palette is a 6 x 7 x 6 colour cube plus the colours used by the user
+  interface, so those are shown exactly.
+
+  A 320 x 240 8-bit Sprite needs 76800 bytes of RAM, half that of a 16-bit
+  Sprite, plus 4.5 kbytes for the palette. The gradient is drawn as an
+  image with and without ordered dithering.
+
+  Example for library:
+  https://github.com/Bodmer/TFT_eSPI
+*/
+
+#include <TFT_eSPI.h>
+
+TFT_eSPI    tft = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&tft);
+
+#define PRIMARY_COLOR 0x7FFA // #7fffd4
+#define FILLER_COLOR  0x52AE // #555577
+
+uint16_t palette[256];
+
+void setup(void)
+{
+  Serial.begin(115200);
+
+  tft.init();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_BLACK);
+
+  // Colour cube, the steps are 51 (red and blue) and 42 (green) in 0-255 units
+  uint16_t n = 0;
+  for (uint8_t r = 0; r < 6; r++)
+    for (uint8_t g = 0; g < 7; g++)
+      for (uint8_t b = 0; b < 6; b++) palette[n++] = tft.color565(r * 51, g * 42, b * 51);
+
+  // User interface colours
+  palette[n++] = PRIMARY_COLOR;
+  palette[n++] = FILLER_COLOR;
+
+  spr.setColorDepth(8);
+  if (spr.createSprite(tft.width(), tft.height()) == nullptr) {
+    Serial.println("Not enough RAM for the Sprite");
+    while (1) yield();
+  }
+
+  // The gradient lines are in normal RGB565 byte order
+  spr.setSwapBytes(true);
+
+  uint32_t t = millis();
+  spr.createPalette(palette, n);
+  Serial.print("Palette created in "); Serial.print(millis() - t); Serial.println(" ms");
+}
+
+void loop()
+{
+  static bool dither = false;
+  uint16_t w = spr.width();
+
+  spr.fillSprite(FILLER_COLOR);
+  spr.fillRoundRect(10, 10, w - 20, 40, 8, PRIMARY_COLOR);
+  spr.setTextColor(TFT_BLACK);
+  spr.setTextDatum(MC_DATUM);
+  spr.drawString(dither ? "Dithered" : "Not dithered", w / 2, 30, 4);
+
+  // Draw a gradient a line at a time as an image
+  spr.setDither(dither ? 48 : 0);
+  uint16_t line[w];
+  for (int32_t y = 70; y < spr.height() - 10; y++) {
+    for (int32_t x = 0; x < w; x++) line[x] = tft.color565(x * 255 / w, y, 255 - x * 255 / w);
+    spr.pushImage(0, y, w, 1, line);
+  }
+
+  spr.pushSprite(0, 0);
+
+  dither = !dither;
+  delay(2000);
+}
@@ -0,0 +1,105 @@
+/*
+  Sketch to show Sprites taking their memory from a TFT_eSPI_SpritePool.
+
+  Each "screen" creates its own Sprites and deletes them when the next
+  screen is shown. With the heap, different sizes created and freed for days
+  can fragment memory until a large Sprite no longer fits. Here the memory is
+  reserved once at startup as fixed size blocks, so a Sprite always gets a
+  block of its size class and the heap is not touched.
+
+  Plan the classes from the Sprites each screen needs at one time:
+    - 16-bit Sprite: 2 * (width * height + 1) bytes
+    -  8-bit Sprite: width * height + 1 bytes, plus 512 and 4096 with a palette
+    -  4-bit Sprite: width * height / 2 + 1 bytes, plus 32 for the palette
+  The pool statistics show how full each class gets.
+
+  Example for library:
+  https://github.com/Bodmer/TFT_eSPI
+*/
+
+#include <TFT_eSPI.h>
+
+TFT_eSPI            tft  = TFT_eSPI();
+TFT_eSPI_SpritePool pool = TFT_eSPI_SpritePool();
+
+TFT_eSprite header = TFT_eSprite(&tft);
+TFT_eSprite gauge  = TFT_eSprite(&tft);
+TFT_eSprite icon   = TFT_eSprite(&tft);
+
+void setup(void)
+{
+  Serial.begin(115200);
+
+  tft.init();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_BLACK);
+
+  pool.addClass(2 * (320 * 40 + 1), 1);  // Header bar
+  pool.addClass(2 * (120 * 120 + 1), 1); // Gauge
+  pool.addClass(2 * (32 * 32 + 1), 4);   // Icons and 4-bit palettes
+
+  if (!pool.begin()) {
+    Serial.println("Not enough RAM for the pool");
+    while (1) yield();
+  }
+
+  header.setPool(&pool);
+  gauge.setPool(&pool);
+  icon.setPool(&pool);
+}
+
+void screenOne(void)
+{
+  header.createSprite(tft.width(), 40);
+  header.fillSprite(TFT_NAVY);
+  header.setTextColor(TFT_WHITE);
+  header.drawString("Screen one", 8, 12, 2);
+  header.pushSprite(0, 0);
+
+  gauge.createSprite(120, 120);
+  gauge.fillSprite(TFT_BLACK);
+  gauge.fillSmoothCircle(60, 60, 55, TFT_DARKGREY);
+  gauge.fillSmoothCircle(60, 60, 40, TFT_BLACK);
+  gauge.pushSprite(20, 60);
+}
+
+void screenTwo(void)
+{
+  header.createSprite(tft.width(), 40);
+  header.fillSprite(TFT_MAROON);
+  header.setTextColor(TFT_WHITE);
+  header.drawString("Screen two", 8, 12, 2);
+  header.pushSprite(0, 0);
+
+  icon.setColorDepth(4);
+  icon.createSprite(32, 32);
+  icon.fillSprite(0);
+  icon.fillCircle(16, 16, 12, 14);
+  for (int i = 0; i < 4; i++) icon.pushSprite(20 + 40 * i, 100);
+}
+
+void changeScreen(uint8_t n)
+{
+  header.deleteSprite();
+  gauge.deleteSprite();
+  icon.deleteSprite();
+
+  tft.fillScreen(TFT_BLACK);
+  if (n == 1) screenOne();
+  else screenTwo();
+}
+
+void loop()
+{
+  static uint8_t screen = 1;
+
+  changeScreen(screen);
+  screen = 3 - screen;
+
+  Serial.print("Pool used ");        Serial.print(pool.used());
+  Serial.print(", high water ");     Serial.print(pool.highWater());
+  Serial.print(", wasted ");         Serial.print(pool.wasted());
+  Serial.print(", largest free ");   Serial.print(pool.largestFree());
+  Serial.print(", failures ");       Serial.println(pool.failures());
+  delay(2000);
+}
@@ -0,0 +1,93 @@
+/*
+
+  Sketch to time the RLE fonts 2, 4, 6, 7 and 8.
+
+  Example for library:
+  https://github.com/Bodmer/TFT_eSPI
+
+  Three workloads are timed on the TFT:
+  - Random short strings in fonts 2, 4, 6, 7 and 8 at text
+    sizes 1 to 3, with transparent and filled backgrounds, some
+    partly off screen so the clipped path is included.
+  - The Font 7 string "12:34" at size 2 with a transparent
+    background, as drawn by a clock.
+  - The same string with a filled background.
+
+  The same random strings are drawn each loop, so results can
+  be compared between library versions. Results are sent to
+  the Serial Monitor in microseconds per string.
+
+  The fonts must be enabled in the setup file, as they are by
+  default.
+
+*/
+
+// Number of strings drawn for each test
+#define LOOPS  100
+
+#include <TFT_eSPI.h>                 // Include the graphics library
+
+TFT_eSPI tft = TFT_eSPI();            // Declare object "tft"
+
+void setup()
+{
+  Serial.begin(250000);
+  Serial.println();
+
+  tft.init();
+  tft.fillScreen(TFT_BLACK);
+}
+
+// Print the average time per string since start time t
+void report(const char *label, uint32_t t)
+{
+  t = (micros() - t) / LOOPS;
+  Serial.print(label);
+  Serial.print(t);
+}
+
+void loop(void)
+{
+  const uint8_t font[] = { 2, 4, 6, 7, 8 };
+  const char    digits[] = "0123456789:-.";
+  char str[6];
+
+  randomSeed(1); // Same strings every loop
+
+  tft.fillScreen(TFT_DARKGREY);
+
+  uint32_t t = micros();
+  for (uint16_t i = 0; i < LOOPS; i++)
+  {
+    uint8_t f = font[random(5)];
+    tft.setTextSize(1 + random(3));
+
+    uint16_t fg = random(0x10000);
+    uint16_t bg = random(2) ? fg : random(0x10000); // Same colour is a transparent background
+    tft.setTextColor(fg, bg);
+
+    uint8_t n = 1 + random(5);
+    for (uint8_t j = 0; j < n; j++) str[j] = (f == 7) ? digits[random(13)] : 32 + random(95);
+    str[n] = 0;
+
+    tft.drawString(str, random(tft.width() + 20) - 30, random(tft.height() + 20) - 30, f);
+  }
+  report("Random strings ", t);
+
+  tft.fillScreen(TFT_BLACK);
+  tft.setTextSize(2);
+
+  tft.setTextColor(TFT_GREEN, TFT_GREEN);
+  t = micros();
+  for (uint16_t i = 0; i < LOOPS; i++) tft.drawString("12:34", 10, 10, 7);
+  report(", Font 7 x2 transparent ", t);
+
+  tft.setTextColor(TFT_GREEN, TFT_BLACK);
+  t = micros();
+  for (uint16_t i = 0; i < LOOPS; i++) tft.drawString("12:34", 10, 10, 7);
+  report(", Font 7 x2 opaque ", t);
+  Serial.println(" us");
+
+  tft.setTextSize(1);
+  delay(5000);
+}
@@ -28,11 +28,13 @@ int fracPart = 0; // 0.0 to 0.9
 
 float tempHistory[210], humiHistory[210];
 double pidOutputHistory[210];
+float traceX[210], traceY[210]; // Trace points for plotTrace()
 int dataCount = 0; // Keeps track of how many values are filled
 
 static int lastSampleTimeMs = -1; // Declare this globally or static inside loop()
 static bool lastSeeGraphInfo = false;
 static bool firstEnter = true;  // Tracks first-time access
+static bool fullRedraw = true;  // Screen has just been cleared by changeScreen()
 bool firstRun = false, dht22ErrorHandled = false, dht22Connected = true, seeGraphInfo = false, pauseReading = false, wasPaused = false;
 uint64_t totalReadings = 0LL;
 double totalTime = 0.0f;
@@ -63,6 +65,11 @@ const int resolution_FANBLOWER = 8; // 8-bit resolution (0–255)
 
 int setTemperature = 26;
 float currentTemperature = 0, currentHumidity = 0;
+
+// Numeric readouts, only the digits that change are redrawn
+TFT_eSPI_Readout setScreenTempReadout, setScreenHumiReadout, setTempReadout;
+TFT_eSPI_Readout graphTempReadout, graphHumiReadout;
+TFT_eSPI_Readout waterLevelReadout, waterSetpointReadout;
 float minTemp = 0, maxTemp = 0, avgTemp = 0;
 float minHumi = 0, maxHumi = 0, avgHumi = 0;
 
@@ -97,10 +104,27 @@ uint16_t RGB565_U16(uint8_t r, uint8_t g, uint8_t b) {
 int clamp(int val, int minVal, int maxVal) {
     return max(minVal, min(val, maxVal));
 }
+
+// Plot history values as one anti-aliased trace inside the graph area, a value maps to
+// (value - minVal) * scaleY pixels above the bottom of the area. xs and ys must hold count
+// points. The edges blend with the pixels already drawn (grid lines, other traces)
+template <typename T>
+void plotTrace(const T *values, int count, float *xs, float *ys, int graphX, int graphY, int graphWidth,
+               int graphHeight, float stepX, float minVal, float scaleY, uint16_t color) {
+    for (int i = 0; i < count; ++i) {
+        xs[i] = min(graphX + i * stepX, (float)(graphX + graphWidth - 1));
+        float y = graphY + graphHeight - (float)(values[i] - minVal) * scaleY;
+        ys[i] = constrain(y, (float)graphY, (float)(graphY + graphHeight - 1));
+    }
+    tft.drawSmoothPolyline(xs, ys, count, 1, color);
+}
 void drawQuadraticBezier(int x0, int y0, int cx, int cy, int x1, int y1, uint16_t color, int segments = 10) {
+    if (segments < 1) return;
     float tStep = 1.0f / segments;
     float t = 0;
-    int prevX = x0, prevY = y0;
+    int16_t xs[segments + 1], ys[segments + 1];
+    xs[0] = x0;
+    ys[0] = y0;
 
     for (int i = 1; i <= segments; ++i) {
         t += tStep;
@@ -108,13 +132,10 @@ void drawQuadraticBezier(int x0, int y0, int cx, int cy, int x1, int y1, uint16_
         float b = 2 * (1 - t) * t;
         float c = t * t;
 
-        int x = a * x0 + b * cx + c * x1;
-        int y = a * y0 + b * cy + c * y1;
-
-        tft.drawLine(prevX, prevY, x, y, color);
-        prevX = x;
-        prevY = y;
+        xs[i] = a * x0 + b * cx + c * x1;
+        ys[i] = a * y0 + b * cy + c * y1;
     }
+    tft.drawPolyline(xs, ys, segments + 1, color);  // One transaction, joints drawn once
 }
 
 void updateHistory(float temp, float humi, double pidOutput) {
@@ -380,9 +401,7 @@ void drawWaterLevelSetpointScreen(const String &title) {
     drawTopBar(title);
 
     // ...
-    char wpShow[4], wspShow[4], wpsShow[32], pwmIndexShow[4];
-    snprintf(wpShow, sizeof(wpShow), "%03d", (int)waterPercent);
-    snprintf(wspShow, sizeof(wspShow), "%02d", (int)waterSetpointPercent);
+    char wpsShow[32], pwmIndexShow[4];
     snprintf(wpsShow, sizeof(wpsShow), "Speed INFO: %s",
         (waterPumpSpeedList[waterPumpSpeedIndex] == 0.5) ? "SLOW" :
         (waterPumpSpeedList[waterPumpSpeedIndex] == 1.0) ? "NORMAL" :
@@ -396,16 +415,14 @@ void drawWaterLevelSetpointScreen(const String &title) {
     tft.setTextDatum(MC_DATUM);
     tft.setTextColor(PRIMARY_COLOR_1, BACKGROUND_COLOR);
     tft.drawString("Actual Water Level:", (tft.width() / 4), wYPos + 15);
-    tft.setTextSize(4);
-    tft.drawString(wpShow, (tft.width() / 4) - 12, wYPos + 60);
+    waterLevelReadout.drawNumber((long)waterPercent);
     tft.setTextSize(3);
     tft.drawString("%", (tft.width() / 4) + 35, wYPos + 45);
 
     tft.setTextSize(1);
     tft.setTextColor(SECONDARY_COLOR_1, BACKGROUND_COLOR);
     tft.drawString("Water Level Setpoint:", (320 - (tft.width() / 4)) - 4, wYPos + 15);
-    tft.setTextSize(4);
-    tft.drawString(wspShow, (320 - (tft.width() / 4)) - 15, wYPos + 60);
+    waterSetpointReadout.drawNumber((long)waterSetpointPercent);
     tft.setTextSize(3);
     tft.drawString("%", (320 - (tft.width() / 4)) + 20, wYPos + 45);
     tft.setTextSize(1);
@@ -496,15 +513,13 @@ void drawSetTemperatureScreen(const String &title) {
     // Temperature - Big number
     tft.setTextColor(TFT_ORANGE, BACKGROUND_COLOR);
     tft.setTextDatum(MC_DATUM);
-    tft.setTextSize(4);
-    tft.drawFloat(currentTemperature, 1, (tft.width() / 4) - 20, 60 + 5);  // Large temperature
+    setScreenTempReadout.drawFloat(currentTemperature);  // Large temperature
     tft.setTextSize(3);
-    tft.drawString("C", (tft.width() / 4) + 45, 45 + 5);  // Degree symbol and unit
+    tft.drawString("C", (tft.width() / 4) + 52, 45 + 5);  // Degree symbol and unit, right of the 0..120 field
 
     // Humidity - Big number
     tft.setTextColor(TFT_CYAN, BACKGROUND_COLOR);
-    tft.setTextSize(4);
-    tft.drawFloat(currentHumidity, 1, (320 - (tft.width() / 4)) - 5, 60 + 5);  // Humidity %
+    setScreenHumiReadout.drawFloat(currentHumidity);  // Humidity %
     tft.setTextSize(3);
     tft.drawString("%", (320 - (tft.width() / 4)) + 60, 45 + 5);
 
@@ -534,14 +549,16 @@ void drawSetTemperatureScreen(const String &title) {
     backBtn.draw();
     graphBtn.draw();
 
-    tft.fillRect(75 + 20, 240 - 20 - 75, 130, 85, TFT_BLACK);
-    tft.drawRect(75 + 20, 240 - 20 - 75, 130, 85, TFT_WHITE);
+    // Box is cleared only when the screen is entered so the readout keeps its digits
+    if (fullRedraw) {
+        tft.fillRect(75 + 20, 240 - 20 - 75, 130, 85, TFT_BLACK);
+        tft.drawRect(75 + 20, 240 - 20 - 75, 130, 85, TFT_WHITE);
+    }
 
     tft.setTextDatum(CC_DATUM);
     tft.setTextColor(TFT_WHITE, TFT_BLACK);
     tft.drawString("Set Temperature:", 105 + 37 + 5, 147 + 5);
-    tft.setTextSize(6);
-    tft.drawNumber(setTemperature, (320 / 2) - 10 + 2, 240 - ((130 / 2) - 15));
+    setTempReadout.drawNumber(setTemperature);
     tft.setTextSize(3);
     tft.drawString("C", (320 / 2) + 36 + 2, 240 - (130 / 2) + 2);
     tft.setTextSize(1);
@@ -554,11 +571,10 @@ void drawTempGraph(const String &title, int setGridGapX = 10) {
     tft.setTextDatum(CC_DATUM);
 
     // --- Temperature Readout ---
-    tft.setTextSize(3);
     tft.setTextColor(TFT_ORANGE, BACKGROUND_COLOR);
-    tft.drawFloat(currentTemperature, 1, 65, 55);
+    graphTempReadout.drawFloat(currentTemperature);
     tft.setTextSize(2);
-    tft.drawString("C", 110, 45);
+    tft.drawString("C", 118, 45); // Right of the 20..110 readout field
 
     // --- Graph Constants ---
     const int labelX = 15;
@@ -624,17 +640,8 @@ void drawTempGraph(const String &title, int setGridGapX = 10) {
         return (t - minTempToUse) * scaleY;
     };
 
-    for (int i = startIndex + 1; i <= endIndex; ++i) {
-        float yPrev = mapTemp(tempHistory[i - 1]);
-        float yCurr = mapTemp(tempHistory[i]);
-
-        int x0 = clamp(graphX + (i - startIndex - 1) * stepX, graphX, graphX + graphWidth);
-        int x1 = clamp(graphX + (i - startIndex) * stepX, graphX, graphX + graphWidth);
-        int y0 = clamp(graphY + graphHeight - yPrev, graphY, graphY + graphHeight);
-        int y1 = clamp(graphY + graphHeight - yCurr, graphY, graphY + graphHeight);
-
-        tft.drawLine(x0, y0, x1, y1, TFT_ORANGE);
-    }
+    plotTrace(tempHistory + startIndex, endIndex - startIndex + 1, traceX, traceY, graphX, graphY, graphWidth,
+              graphHeight, stepX, minTempToUse, scaleY, TFT_ORANGE);
 
     // --- Set Temperature Reference Line ---
     float ySet = mapTemp(setTemperature);
@@ -711,11 +718,10 @@ void drawHumiGraph(const String &title, int setGridGapX = 10) {
     }
 
     // Current humidity display
-    tft.setTextSize(3);
     tft.setTextColor(TFT_CYAN, BACKGROUND_COLOR);
-    tft.drawFloat(currentHumidity, 1, 65, 55);
+    graphHumiReadout.drawFloat(currentHumidity);
     tft.setTextSize(2);
-    tft.drawString("%", 110, 45);
+    tft.drawString("%", 118, 45); // Right of the 20..110 readout field
 
     // Graph settings
     const int graphX = 30, graphY = 80;
@@ -748,23 +754,8 @@ void drawHumiGraph(const String &title, int setGridGapX = 10) {
     float scaleY = graphHeight / (maxVal - minVal);
     float stepX = (float)graphWidth / (visibleSize - 1);
 
-    for (int i = startIndex + 1; i <= endIndex; i++) {
-        float valPrev = humiHistory[i - 1];
-        float valCurr = humiHistory[i];
-
-        int x0 = graphX + round(stepX * (i - startIndex - 1));
-        int x1 = graphX + round(stepX * (i - startIndex));
-        int y0 = graphY + graphHeight - (valPrev - minVal) * scaleY;
-        int y1 = graphY + graphHeight - (valCurr - minVal) * scaleY;
-
-        // Clamp to bounds to avoid overflow
-        x0 = constrain(x0, graphX, graphX + graphWidth);
-        x1 = constrain(x1, graphX, graphX + graphWidth);
-        y0 = constrain(y0, graphY, graphY + graphHeight);
-        y1 = constrain(y1, graphY, graphY + graphHeight);
-
-        tft.drawLine(x0, y0, x1, y1, TFT_CYAN);
-    }
+    plotTrace(humiHistory + startIndex, endIndex - startIndex + 1, traceX, traceY, graphX, graphY, graphWidth,
+              graphHeight, stepX, minVal, scaleY, TFT_CYAN);
 
     // --- Buttons ---
     tft.setTextColor(TFT_WHITE, BACKGROUND_COLOR);
@@ -885,24 +876,11 @@ void drawPIDGraph(const String &title, int setGridGapX = 10) {
 
     float stepX = (visibleSize > 1) ? (float)graphWidth / (visibleSize - 1) : 1;
 
-    // --- Plot PID Output and Temperature ---
-    for (int i = startIndex + 1; i <= endIndex; ++i) {
-        int idx0 = i - 1;
-        int idx1 = i;
-
-        float x0 = graphX + (idx0 - startIndex) * stepX;
-        float x1 = graphX + (idx1 - startIndex) * stepX;
-
-        // Output (CYAN)
-        int y0_out = mapToY(pidOutputHistory[idx0]);
-        int y1_out = mapToY(pidOutputHistory[idx1]);
-        tft.drawLine(x0, y0_out, x1, y1_out, TFT_CYAN);
-
-        // Input / Temperature (ORANGE)
-        int y0_in = mapToY(tempHistory[idx0]);
-        int y1_in = mapToY(tempHistory[idx1]);
-        tft.drawLine(x0, y0_in, x1, y1_in, TFT_ORANGE);
-    }
+    // --- Plot PID Output (CYAN) and Temperature (ORANGE) ---
+    plotTrace(pidOutputHistory + startIndex, endIndex - startIndex + 1, traceX, traceY, graphX, graphY, graphWidth,
+              graphHeight, stepX, minOutput, scaleY, TFT_CYAN);
+    plotTrace(tempHistory + startIndex, endIndex - startIndex + 1, traceX, traceY, graphX, graphY, graphWidth,
+              graphHeight, stepX, minOutput, scaleY, TFT_ORANGE);
 
     // --- Draw Setpoint Line (MAGENTA) ---
     int setY = mapToY(setTemperature);
@@ -956,12 +934,57 @@ void drawPIDGraph(const String &title, int setGridGapX = 10) {
     }
 }
 
+void initReadouts() {
+    setScreenTempReadout.init(&tft, (tft.width() / 4) - 20, 60 + 5, 5, 1, 1, MC_DATUM);
+    setScreenTempReadout.setTextSize(4);
+    setScreenTempReadout.setTextColor(TFT_ORANGE, BACKGROUND_COLOR);
+
+    setScreenHumiReadout.init(&tft, (320 - (tft.width() / 4)) - 12, 60 + 5, 5, 1, 1, MC_DATUM); // 168..288, left of "%"
+    setScreenHumiReadout.setTextSize(4);
+    setScreenHumiReadout.setTextColor(TFT_CYAN, BACKGROUND_COLOR);
+
+    setTempReadout.init(&tft, (320 / 2) - 10 + 2, 240 - ((130 / 2) - 15), 2, 0, 1, CC_DATUM);
+    setTempReadout.setTextSize(6);
+    setTempReadout.setTextColor(TFT_WHITE, TFT_BLACK);
+
+    graphTempReadout.init(&tft, 65, 55, 5, 1, 1, CC_DATUM);
+    graphTempReadout.setTextSize(3);
+    graphTempReadout.setTextColor(TFT_ORANGE, BACKGROUND_COLOR);
+
+    graphHumiReadout.init(&tft, 65, 55, 5, 1, 1, CC_DATUM);
+    graphHumiReadout.setTextSize(3);
+    graphHumiReadout.setTextColor(TFT_CYAN, BACKGROUND_COLOR);
+
+    waterLevelReadout.init(&tft, (tft.width() / 4) - 12, 30 + 60, 3, 0, 1, MC_DATUM);
+    waterLevelReadout.setTextSize(4);
+    waterLevelReadout.setTextColor(PRIMARY_COLOR_1, BACKGROUND_COLOR);
+    waterLevelReadout.setZeroPad(true);
+
+    waterSetpointReadout.init(&tft, (320 - (tft.width() / 4)) - 15, 30 + 60, 2, 0, 1, MC_DATUM);
+    waterSetpointReadout.setTextSize(4);
+    waterSetpointReadout.setTextColor(SECONDARY_COLOR_1, BACKGROUND_COLOR);
+    waterSetpointReadout.setZeroPad(true);
+}
+
+// The screen is cleared so every readout must draw all of its digits again
+void invalidateReadouts() {
+    setScreenTempReadout.invalidate();
+    setScreenHumiReadout.invalidate();
+    setTempReadout.invalidate();
+    graphTempReadout.invalidate();
+    graphHumiReadout.invalidate();
+    waterLevelReadout.invalidate();
+    waterSetpointReadout.invalidate();
+}
+
 void changeScreen(ScreenState next) {
     previousScreen = currentScreen;
     currentScreen = next;
 
     resetAllButtons();  // Clear visual states
     tft.fillScreen(BACKGROUND_COLOR);
+    invalidateReadouts();
+    fullRedraw = true;
     switch (currentScreen) {
         case SCREEN_MAIN: drawMainScreen(); break;
         case SCREEN_TemperatureSetpoint: drawSetTemperatureScreen("Temperature Setpoint"); break;
@@ -975,6 +998,7 @@ void changeScreen(ScreenState next) {
         default: /* optional fallback or logging */ break;
     }
 
+    fullRedraw = false;
     firstEnter = true;
 }
 
@@ -985,6 +1009,7 @@ void setup() {
     tft.init();
     tft.setRotation(1);
     tft.setTextFont(1);
+    initReadouts();
 
     Setpoint = setTemperature; // Target temperature in °C
     myPID.SetMode(AUTOMATIC);